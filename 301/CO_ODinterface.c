@@ -59,6 +59,12 @@ OD_readOriginal(OD_stream_t* stream, void* buf, OD_size_t count, OD_size_t* coun
 
     (void)memcpy((void*)buf, (const void*)dataOrig, dataLenToCopy);
 
+#if ((CO_CONFIG_OD)&CO_CONFIG_OD_PROFILE) != 0
+    if ((returnCode == ODR_OK) && (stream->profile != NULL)) {
+        stream->profile->read++;
+    }
+#endif
+
     *countRead = dataLenToCopy;
     return returnCode;
 }
@@ -115,11 +121,40 @@ OD_writeOriginal(OD_stream_t* stream, const void* buf, OD_size_t count, OD_size_
         return ODR_DEV_INCOMPAT;
     }
 
+#if ((CO_CONFIG_OD)&CO_CONFIG_OD_PROFILE) != 0
+    if ((returnCode == ODR_OK) && (stream->profile != NULL)) {
+        stream->profile->write++;
+    }
+#endif
+
     *countWritten = dataLenToCopy;
     return returnCode;
 }
 #endif /* CO_OVERRIDE_OD_WRITE_ORIGINAL */
 
+#if ((CO_CONFIG_OD)&CO_CONFIG_OD_PROFILE) != 0
+/* Profiled Object Dictionary and its counters, from OD_profileInit() */
+static OD_t* OD_profileOD = NULL;
+static OD_profile_t* OD_profileCounters = NULL;
+
+/* Get counters of the OD entry or NULL, if entry is not in the profiled OD list */
+static OD_profile_t*
+OD_profileOf(const OD_entry_t* entry) {
+    if ((OD_profileCounters == NULL) || (entry < &OD_profileOD->list[0])
+        || (entry >= &OD_profileOD->list[OD_profileOD->size])) {
+        return NULL;
+    }
+    return &OD_profileCounters[entry - &OD_profileOD->list[0]];
+}
+
+/* Sum of counters of the OD entry from the profiled OD list */
+static uint64_t
+OD_profileSum(const OD_entry_t* entry) {
+    const OD_profile_t* profile = &OD_profileCounters[entry - &OD_profileOD->list[0]];
+    return (uint64_t)profile->read + profile->write;
+}
+#endif
+
 /* Read value from variable from Object Dictionary disabled, see OD_IO_t */
 static ODR_t
 OD_readDisabled(OD_stream_t* stream, void* buf, OD_size_t count, OD_size_t* countRead) {
@@ -241,6 +276,28 @@ OD_getSub(const OD_entry_t* entry, uint8_t subIndex, OD_IO_t* io, bool_t odOrig)
             stream->dataLength = odo->dataLength;
             break;
         }
+        case ODT_RECF: {
+            CO_PROGMEM OD_obj_recordFamily_t* odo = entry->odObject;
+            CO_PROGMEM OD_obj_recordSub_t* sub = NULL;
+            for (uint8_t i = 0; i < entry->subEntriesCount; i++) {
+                if (odo->subs[i].subIndex == subIndex) {
+                    sub = &odo->subs[i];
+                    break;
+                }
+            }
+            if (sub == NULL) {
+                ret = ODR_SUB_NOT_EXIST;
+                break;
+            }
+
+            stream->attribute = sub->attribute;
+            uint8_t* ptr = odo->dataOrig;
+            stream->dataOrig = (ptr == NULL) ? ptr
+                                             : (ptr + ((OD_size_t)(entry->index - odo->indexFirst) * odo->stride)
+                                                + sub->dataOffset);
+            stream->dataLength = sub->dataLength;
+            break;
+        }
         default: {
             ret = ODR_DEV_INCOMPAT;
             break;
@@ -267,6 +324,9 @@ OD_getSub(const OD_entry_t* entry, uint8_t subIndex, OD_IO_t* io, bool_t odOrig)
         /* Add informative data */
         stream->index = entry->index;
         stream->subIndex = subIndex;
+#if ((CO_CONFIG_OD)&CO_CONFIG_OD_PROFILE) != 0
+        stream->profile = OD_profileOf(entry);
+#endif
     }
 
     return ret;
@@ -373,3 +433,618 @@ OD_getPtr(const OD_entry_t* entry, uint8_t subIndex, OD_size_t len, ODR_t* err)
 
     return (errCopy == ODR_OK) ? stream->dataOrig : NULL;
 }
+
+/*
+ * Find OD entry in ordered Object Dictionary, search only from position *cursor to the end of the list. If entry is
+ * found, *cursor is set to its position, so next search with larger index continues from there.
+ */
+static OD_entry_t*
+OD_findFrom(OD_t* od, uint16_t index, uint16_t* cursor) {
+    uint16_t min = *cursor;
+    uint16_t max = od->size - 1U;
+
+    if ((min > max) || (index < od->list[min].index)) {
+        min = 0; /* items are not sorted, search from beginning */
+    }
+
+    while (min < max) {
+        uint16_t cur = (min + max) >> 1;
+        OD_entry_t* entry = &od->list[cur];
+
+        if (index == entry->index) {
+            *cursor = cur;
+            return entry;
+        }
+
+        if (index < entry->index) {
+            max = (cur > min) ? (cur - 1U) : cur;
+        } else {
+            min = cur + 1U;
+        }
+    }
+
+    if ((min == max) && (index == od->list[min].index)) {
+        *cursor = min;
+        return &od->list[min];
+    }
+
+    return NULL; /* entry does not exist in OD */
+}
+
+/*
+ * Common function for OD_readMany() and OD_writeMany().
+ */
+static ODR_t
+OD_accessMany(OD_t* od, OD_multiItem_t* items, uint16_t count, bool_t odOrig, CO_CANmodule_t* CANmodule,
+              bool_t write) {
+    (void)CANmodule; /* may be unused */
+    ODR_t retFirst = ODR_OK;
+    uint16_t cursor = 0;
+    OD_entry_t* entry = NULL;
+
+    if ((od == NULL) || (od->size == 0U) || ((items == NULL) && (count > 0U))) {
+        return ODR_DEV_INCOMPAT;
+    }
+
+    CO_LOCK_OD(CANmodule);
+    for (uint16_t i = 0; i < count; i++) {
+        OD_multiItem_t* item = &items[i];
+        OD_IO_t io = {NULL};
+        OD_size_t countRdWr = 0;
+
+        /* consecutive items often share the same entry */
+        if ((entry == NULL) || (entry->index != item->index)) {
+            entry = OD_findFrom(od, item->index, &cursor);
+        }
+
+        if (item->buf == NULL) {
+            item->ret = ODR_DEV_INCOMPAT;
+        } else if (entry == NULL) {
+            item->ret = ODR_IDX_NOT_EXIST;
+        } else {
+            item->ret = OD_getSub(entry, item->subIndex, &io, odOrig);
+        }
+
+        if (item->ret == ODR_OK) {
+            OD_size_t dataLen = io.stream.dataLength;
+            if (write) {
+                if ((dataLen != 0U) && (dataLen != item->len)) {
+                    item->ret = (item->len > dataLen) ? ODR_DATA_LONG : ODR_DATA_SHORT;
+                } else {
+                    item->ret = io.write(&io.stream, item->buf, item->len, &countRdWr);
+                }
+            } else {
+                item->ret = io.read(&io.stream, item->buf, item->len, &countRdWr);
+            }
+        }
+
+        item->len = countRdWr;
+        if ((item->ret != ODR_OK) && (retFirst == ODR_OK)) {
+            retFirst = item->ret;
+        }
+    }
+    CO_UNLOCK_OD(CANmodule);
+
+    return retFirst;
+}
+
+ODR_t
+OD_readMany(OD_t* od, OD_multiItem_t* items, uint16_t count, bool_t odOrig, CO_CANmodule_t* CANmodule) {
+    return OD_accessMany(od, items, count, odOrig, CANmodule, false);
+}
+
+ODR_t
+OD_writeMany(OD_t* od, OD_multiItem_t* items, uint16_t count, bool_t odOrig, CO_CANmodule_t* CANmodule) {
+    return OD_accessMany(od, items, count, odOrig, CANmodule, true);
+}
+
+#ifdef CO_BIG_ENDIAN
+/*
+ * Reverse bytes of each element inside packed buffer
+ */
+static void
+OD_swapElements(uint8_t* buf, OD_size_t elementLength, uint8_t elementCount) {
+    for (uint8_t i = 0; i < elementCount; i++) {
+        uint8_t* lo = buf;
+        uint8_t* hi = buf + elementLength - 1U;
+        while (lo < hi) {
+            uint8_t swap = *lo;
+            *lo++ = *hi;
+            *hi-- = swap;
+        }
+        buf += elementLength;
+    }
+}
+#endif
+
+/*
+ * Verify arguments for OD_readArray() and OD_writeArray()
+ *
+ * Returns ODR_OK, if entry is an array and subIndexFirst and subCount specify valid range of its elements.
+ */
+static ODR_t
+OD_verifyArray(const OD_entry_t* entry, uint8_t subIndexFirst, uint8_t subCount, const void* buf) {
+    if ((entry == NULL) || (entry->odObject == NULL)) {
+        return ODR_IDX_NOT_EXIST;
+    }
+    if (buf == NULL) {
+        return ODR_DEV_INCOMPAT;
+    }
+    if ((entry->odObjectType & (uint8_t)ODT_TYPE_MASK) != (uint8_t)ODT_ARR) {
+        return ODR_UNSUPP_ACCESS;
+    }
+    CO_PROGMEM OD_obj_array_t* odo = entry->odObject;
+    if (odo->dataElementLength == 0U) {
+        return ODR_UNSUPP_ACCESS;
+    }
+    if ((subIndexFirst == 0U) || (((uint16_t)subIndexFirst + subCount) > entry->subEntriesCount)) {
+        return ODR_SUB_NOT_EXIST;
+    }
+    return ODR_OK;
+}
+
+/*
+ * Read or write elements of OD array one by one, with IO extension
+ */
+static ODR_t
+OD_accessArrayExt(const OD_entry_t* entry, uint8_t subIndexFirst, uint8_t subCount, uint8_t* bufRd,
+                  const uint8_t* bufWr, OD_size_t elementLength) {
+    for (uint8_t i = 0; i < subCount; i++) {
+        OD_IO_t io;
+        OD_size_t countRdWr = 0;
+        ODR_t ret = OD_getSub(entry, subIndexFirst + i, &io, false);
+
+        if (ret != ODR_OK) {
+            return ret;
+        }
+        if (bufRd != NULL) {
+            ret = io.read(&io.stream, &bufRd[elementLength * i], elementLength, &countRdWr);
+        } else {
+            const uint8_t* element = &bufWr[elementLength * i];
+#ifdef CO_BIG_ENDIAN
+            uint8_t swapped[8];
+            if (((io.stream.attribute & ODA_MB) != 0) && (elementLength <= sizeof(swapped))) {
+                (void)memcpy(swapped, element, elementLength);
+                OD_swapElements(swapped, elementLength, 1);
+                element = swapped;
+            }
+#endif
+            ret = io.write(&io.stream, element, elementLength, &countRdWr);
+        }
+        if (ret != ODR_OK) {
+            return (ret == ODR_PARTIAL) ? ODR_DEV_INCOMPAT : ret;
+        }
+        if (countRdWr != elementLength) {
+            return ODR_DEV_INCOMPAT;
+        }
+    }
+    return ODR_OK;
+}
+
+ODR_t
+OD_readArray(const OD_entry_t* entry, uint8_t subIndexFirst, uint8_t subCount, void* buf, OD_size_t count,
+             OD_size_t* countRead, bool_t odOrig) {
+    ODR_t ret = OD_verifyArray(entry, subIndexFirst, subCount, buf);
+    if ((ret == ODR_OK) && (countRead == NULL)) {
+        ret = ODR_DEV_INCOMPAT;
+    }
+    if (ret != ODR_OK) {
+        return ret;
+    }
+
+    CO_PROGMEM OD_obj_array_t* odo = entry->odObject;
+    OD_size_t elementLength = odo->dataElementLength;
+    OD_size_t len = elementLength * subCount;
+    uint8_t* bufRd = (uint8_t*)buf;
+
+    if (len > count) {
+        return ODR_DATA_SHORT;
+    }
+
+    if ((entry->extension != NULL) && !odOrig) {
+        ret = OD_accessArrayExt(entry, subIndexFirst, subCount, bufRd, NULL, elementLength);
+    } else if (odo->dataOrig == NULL) {
+        ret = ODR_SUB_NOT_EXIST;
+    } else {
+        const uint8_t* dataOrig = (const uint8_t*)odo->dataOrig + (odo->dataElementSizeof * (subIndexFirst - 1U));
+
+        if (odo->dataElementSizeof == elementLength) {
+            (void)memcpy(bufRd, dataOrig, len);
+        } else {
+            for (uint8_t i = 0; i < subCount; i++) {
+                (void)memcpy(&bufRd[elementLength * i], &dataOrig[odo->dataElementSizeof * i], elementLength);
+            }
+        }
+#if ((CO_CONFIG_OD)&CO_CONFIG_OD_PROFILE) != 0
+        OD_profile_t* profile = OD_profileOf(entry);
+        if (profile != NULL) {
+            profile->read += subCount;
+        }
+#endif
+    }
+
+    if (ret != ODR_OK) {
+        return ret;
+    }
+#ifdef CO_BIG_ENDIAN
+    if ((odo->attribute & ODA_MB) != 0) {
+        OD_swapElements(bufRd, elementLength, subCount);
+    }
+#endif
+    *countRead = len;
+    return ODR_OK;
+}
+
+ODR_t
+OD_writeArray(const OD_entry_t* entry, uint8_t subIndexFirst, uint8_t subCount, const void* buf,
+              OD_size_t count, bool_t odOrig) {
+    ODR_t ret = OD_verifyArray(entry, subIndexFirst, subCount, buf);
+    if (ret != ODR_OK) {
+        return ret;
+    }
+
+    CO_PROGMEM OD_obj_array_t* odo = entry->odObject;
+    OD_size_t elementLength = odo->dataElementLength;
+    OD_size_t len = elementLength * subCount;
+    const uint8_t* bufWr = (const uint8_t*)buf;
+
+    if (count != len) {
+        return (count > len) ? ODR_DATA_LONG : ODR_DATA_SHORT;
+    }
+
+    if ((entry->extension != NULL) && !odOrig) {
+        return OD_accessArrayExt(entry, subIndexFirst, subCount, NULL, bufWr, elementLength);
+    }
+    if (odo->dataOrig == NULL) {
+        return ODR_SUB_NOT_EXIST;
+    }
+
+    uint8_t* dataOrig = (uint8_t*)odo->dataOrig + (odo->dataElementSizeof * (subIndexFirst - 1U));
+
+    if (odo->dataElementSizeof == elementLength) {
+        (void)memcpy(dataOrig, bufWr, len);
+#ifdef CO_BIG_ENDIAN
+        if ((odo->attribute & ODA_MB) != 0) {
+            OD_swapElements(dataOrig, elementLength, subCount);
+        }
+#endif
+    } else {
+        for (uint8_t i = 0; i < subCount; i++) {
+            uint8_t* element = &dataOrig[odo->dataElementSizeof * i];
+            (void)memcpy(element, &bufWr[elementLength * i], elementLength);
+#ifdef CO_BIG_ENDIAN
+            if ((odo->attribute & ODA_MB) != 0) {
+                OD_swapElements(element, elementLength, 1);
+            }
+#endif
+        }
+    }
+#if ((CO_CONFIG_OD)&CO_CONFIG_OD_PROFILE) != 0
+    OD_profile_t* profile = OD_profileOf(entry);
+    if (profile != NULL) {
+        profile->write += subCount;
+    }
+#endif
+    return ODR_OK;
+}
+
+#if ((CO_CONFIG_OD)&CO_CONFIG_OD_ARRAY_DOMAIN) != 0
+/*
+ * Read part of single OD array element, from offset inside the element, as much as fits into buf
+ *
+ * Used for element, which does not fit into the rest of the buffer or was partially read before. Returns ODR_OK, if
+ * data was read, countRead is set.
+ */
+static ODR_t
+OD_readArrayElementPart(const OD_entry_t* array, uint8_t subIndex, OD_size_t offset, uint8_t* buf, OD_size_t count,
+                        OD_size_t* countRead) {
+    OD_IO_t io;
+    ODR_t ret = OD_getSub(array, subIndex, &io, false);
+    if (ret != ODR_OK) {
+        return ret;
+    }
+#ifdef CO_BIG_ENDIAN
+    if ((io.stream.attribute & ODA_MB) != 0) {
+        /* multi-byte element (up to 8 bytes) must be swapped as a whole */
+        uint8_t element[8];
+        OD_size_t len = 0;
+        ret = OD_readArray(array, subIndex, 1, element, sizeof(element), &len, false);
+        if (ret != ODR_OK) {
+            return ret;
+        }
+        len -= offset;
+        if (len > count) {
+            len = count;
+        }
+        (void)memcpy(buf, &element[offset], len);
+        *countRead = len;
+        return ODR_OK;
+    }
+#endif
+    io.stream.dataOffset = offset;
+    ret = io.read(&io.stream, buf, count, countRead);
+    return (ret == ODR_PARTIAL) ? ODR_OK : ret;
+}
+
+/*
+ * Custom function for reading OD domain, which contains the whole OD array
+ *
+ * For more information see file CO_ODinterface.h, OD_IO_t.
+ */
+static ODR_t
+OD_read_arrayDomain(OD_stream_t* stream, void* buf, OD_size_t count, OD_size_t* countRead) {
+    if ((stream == NULL) || (buf == NULL) || (countRead == NULL)) {
+        return ODR_DEV_INCOMPAT;
+    }
+
+    OD_arrayDomain_t* arrayDomain = stream->object;
+    OD_entry_t* array = arrayDomain->array;
+    CO_PROGMEM OD_obj_array_t* odo = array->odObject;
+    OD_size_t elementLength = odo->dataElementLength;
+    uint8_t elementsTotal = array->subEntriesCount - 1U;
+
+    /* size of all data is known in advance */
+    stream->dataLength = elementLength * elementsTotal;
+    if (stream->dataLength == 0U) {
+        return ODR_NO_DATA;
+    }
+
+    uint8_t* bufRd = (uint8_t*)buf;
+    OD_size_t countRd = 0;
+    ODR_t ret = ODR_OK;
+
+    /* fill the buffer: rest of the element, which was partially read before, then as many whole elements as fit into
+     * buffer, then first part of the next element */
+    while ((countRd < count) && ((stream->dataOffset + countRd) < stream->dataLength)) {
+        OD_size_t offset = stream->dataOffset + countRd;
+        uint8_t elementsDone = (uint8_t)(offset / elementLength);
+        OD_size_t elementOffset = offset % elementLength;
+        OD_size_t elementsFit = (count - countRd) / elementLength;
+        uint8_t subCount = elementsTotal - elementsDone;
+        OD_size_t n = 0;
+
+        if (elementsFit < subCount) {
+            subCount = (uint8_t)elementsFit;
+        }
+        if ((subCount == 0U) || (elementOffset > 0U)) {
+            ret = OD_readArrayElementPart(array, elementsDone + 1U, elementOffset, &bufRd[countRd], count - countRd,
+                                          &n);
+        } else {
+            ret = OD_readArray(array, elementsDone + 1U, subCount, &bufRd[countRd], count - countRd, &n, false);
+        }
+        if (ret != ODR_OK) {
+            return ret;
+        }
+        if (n == 0U) {
+            return ODR_DEV_INCOMPAT;
+        }
+        countRd += n;
+    }
+    if (countRd == 0U) {
+        return ODR_DATA_SHORT;
+    }
+
+    *countRead = countRd;
+    stream->dataOffset += *countRead;
+    if (stream->dataOffset < stream->dataLength) {
+        return ODR_PARTIAL;
+    }
+    stream->dataOffset = 0;
+    return ODR_OK;
+}
+
+/*
+ * Custom function for writing OD domain, which contains the whole OD array
+ *
+ * For more information see file CO_ODinterface.h, OD_IO_t.
+ */
+static ODR_t
+OD_write_arrayDomain(OD_stream_t* stream, const void* buf, OD_size_t count, OD_size_t* countWritten) {
+    (void)stream;
+    (void)buf;
+    (void)count;
+    (void)countWritten;
+    return ODR_READONLY;
+}
+
+ODR_t
+OD_arrayDomain_init(OD_arrayDomain_t* arrayDomain, OD_entry_t* OD_array, OD_entry_t* OD_domain) {
+    if ((arrayDomain == NULL) || (OD_array == NULL) || (OD_array->odObject == NULL)
+        || ((OD_array->odObjectType & (uint8_t)ODT_TYPE_MASK) != (uint8_t)ODT_ARR)) {
+        return ODR_DEV_INCOMPAT;
+    }
+    CO_PROGMEM OD_obj_array_t* odo = OD_array->odObject;
+    if (odo->dataElementLength == 0U) {
+        return ODR_DEV_INCOMPAT;
+    }
+
+    arrayDomain->array = OD_array;
+    arrayDomain->extension.object = arrayDomain;
+    arrayDomain->extension.read = OD_read_arrayDomain;
+    arrayDomain->extension.write = OD_write_arrayDomain;
+    return OD_extension_init(OD_domain, &arrayDomain->extension);
+}
+#endif /* (CO_CONFIG_OD) & CO_CONFIG_OD_ARRAY_DOMAIN */
+
+#if ((CO_CONFIG_OD)&CO_CONFIG_OD_PROFILE) != 0
+ODR_t
+OD_profileInit(OD_t* od, OD_profile_t counters[], uint16_t countersSize) {
+    if ((od == NULL) || (od->list == NULL) || (counters == NULL) || (countersSize < od->size)) {
+        return ODR_DEV_INCOMPAT;
+    }
+
+    (void)memset(counters, 0, od->size * sizeof(OD_profile_t));
+    OD_profileOD = od;
+    OD_profileCounters = counters;
+    return ODR_OK;
+}
+
+const OD_profile_t*
+OD_profileGet(const OD_entry_t* entry) {
+    return OD_profileOf(entry);
+}
+
+OD_entry_t*
+OD_profileGetTop(OD_t* od, uint16_t rank) {
+    if ((od == NULL) || (od != OD_profileOD) || (OD_profileCounters == NULL)) {
+        return NULL;
+    }
+
+    /* Entries are ordered by sum of counters (descending) and then by position in the list (ascending). On each pass
+     * find the largest entry, which is below the entry found in previous pass. */
+    OD_entry_t* found = NULL;
+    uint64_t prevCnt = UINT64_MAX;
+    uint16_t prevPos = 0;
+
+    for (uint32_t r = 0; r <= rank; r++) {
+        uint64_t bestCnt = 0;
+        uint16_t bestPos = 0;
+        found = NULL;
+
+        for (uint16_t i = 0; i < od->size; i++) {
+            uint64_t cnt = OD_profileSum(&od->list[i]);
+            bool_t belowPrev = (cnt < prevCnt) || ((cnt == prevCnt) && (i > prevPos));
+
+            if (belowPrev && (cnt > bestCnt)) {
+                bestCnt = cnt;
+                bestPos = i;
+                found = &od->list[i];
+            }
+        }
+
+        if (found == NULL) {
+            break;
+        }
+        prevCnt = bestCnt;
+        prevPos = bestPos;
+    }
+
+    return found;
+}
+
+uint16_t
+OD_profileGetTopList(OD_t* od, OD_entry_t* top[], uint16_t count) {
+    uint16_t found = 0;
+
+    if ((od == NULL) || (od != OD_profileOD) || (OD_profileCounters == NULL) || (top == NULL)) {
+        return 0;
+    }
+
+    /* insert each accessed entry into sorted list, after the entries with the same or larger sum of counters */
+    for (uint16_t i = 0; i < od->size; i++) {
+        OD_entry_t* entry = &od->list[i];
+        uint64_t cnt = OD_profileSum(entry);
+        uint16_t pos = found;
+
+        if (cnt == 0U) {
+            continue;
+        }
+        while ((pos > 0U) && (OD_profileSum(top[pos - 1U]) < cnt)) {
+            pos--;
+        }
+        if (pos >= count) {
+            continue;
+        }
+        if (found < count) {
+            found++;
+        }
+        for (uint16_t j = found - 1U; j > pos; j--) {
+            top[j] = top[j - 1U];
+        }
+        top[pos] = entry;
+    }
+
+    return found;
+}
+
+void
+OD_profileReset(OD_t* od) {
+    if ((od == NULL) || (od != OD_profileOD) || (OD_profileCounters == NULL)) {
+        return;
+    }
+    (void)memset(OD_profileCounters, 0, od->size * sizeof(OD_profile_t));
+}
+
+/*
+ * Custom function for reading OD profile record
+ *
+ * For more information see file CO_ODinterface.h, OD_IO_t.
+ */
+static ODR_t
+OD_read_profile(OD_stream_t* stream, void* buf, OD_size_t count, OD_size_t* countRead) {
+    if ((stream == NULL) || (buf == NULL) || (countRead == NULL)) {
+        return ODR_DEV_INCOMPAT;
+    }
+    if (stream->subIndex < 2U) {
+        return OD_readOriginal(stream, buf, count, countRead);
+    }
+    if (count < ((stream->subIndex == 2U) ? 2U : 4U)) {
+        return ODR_DEV_INCOMPAT;
+    }
+
+    OD_profileObj_t* profileObj = stream->object;
+    const OD_entry_t* entry = NULL;
+    const OD_profile_t* profile = NULL;
+    if ((profileObj->rank > 0U) && (profileObj->rank <= profileObj->topCount)) {
+        entry = profileObj->top[profileObj->rank - 1U];
+        profile = OD_profileOf(entry);
+    }
+
+    switch (stream->subIndex) {
+        case 2: *countRead = CO_setUint16(buf, (entry != NULL) ? entry->index : 0U); break;
+        case 3: *countRead = CO_setUint32(buf, (profile != NULL) ? profile->read : 0U); break;
+        case 4: *countRead = CO_setUint32(buf, (profile != NULL) ? profile->write : 0U); break;
+        default: return ODR_SUB_NOT_EXIST;
+    }
+
+    return ODR_OK;
+}
+
+/*
+ * Custom function for writing OD profile record
+ *
+ * For more information see file CO_ODinterface.h, OD_IO_t.
+ */
+static ODR_t
+OD_write_profile(OD_stream_t* stream, const void* buf, OD_size_t count, OD_size_t* countWritten) {
+    if ((stream == NULL) || (buf == NULL) || (countWritten == NULL)) {
+        return ODR_DEV_INCOMPAT;
+    }
+    if (stream->subIndex != 1U) {
+        return ODR_READONLY;
+    }
+    if (count != 1U) {
+        return ODR_TYPE_MISMATCH;
+    }
+
+    OD_profileObj_t* profileObj = stream->object;
+    uint8_t rank = CO_getUint8(buf);
+    if (rank > CO_CONFIG_OD_PROFILE_TOP_COUNT) {
+        return ODR_VALUE_HIGH;
+    }
+    profileObj->rank = rank;
+    if (rank == 0U) {
+        OD_profileReset(profileObj->od);
+        profileObj->topCount = 0;
+    } else {
+        profileObj->topCount = OD_profileGetTopList(profileObj->od, profileObj->top, CO_CONFIG_OD_PROFILE_TOP_COUNT);
+    }
+
+    return OD_writeOriginal(stream, buf, count, countWritten);
+}
+
+ODR_t
+OD_profileObj_init(OD_profileObj_t* profileObj, OD_t* od, OD_entry_t* OD_profileRecord) {
+    if ((profileObj == NULL) || (od == NULL)) {
+        return ODR_DEV_INCOMPAT;
+    }
+
+    profileObj->od = od;
+    profileObj->rank = 0;
+    profileObj->topCount = 0;
+    profileObj->extension.object = profileObj;
+    profileObj->extension.read = OD_read_profile;
+    profileObj->extension.write = OD_write_profile;
+    return OD_extension_init(OD_profileRecord, &profileObj->extension);
+}
+#endif /* (CO_CONFIG_OD) & CO_CONFIG_OD_PROFILE */
@@ -50,6 +50,14 @@ typedef uint8_t OD_attr_t;  /**< Type (and size) of Object Dictionary attribute
 #define CO_PROGMEM const
 #endif
 
+/* default configuration, see CO_config.h */
+#ifndef CO_CONFIG_OD
+#define CO_CONFIG_OD (0)
+#endif
+#ifndef CO_CONFIG_OD_PROFILE_TOP_COUNT
+#define CO_CONFIG_OD_PROFILE_TOP_COUNT 10U
+#endif
+
 /**
  * Common DS301 object dictionary entries.
  */
@@ -158,6 +166,16 @@ typedef enum {
     ODR_COUNT = 26           /**< Last element, number of responses */
 } ODR_t;
 
+#if (((CO_CONFIG_OD)&CO_CONFIG_OD_PROFILE) != 0) || defined CO_DOXYGEN
+/**
+ * Access counters for one OD entry, see @ref CO_ODprofile.
+ */
+typedef struct {
+    uint32_t read;  /**< Number of completed reads from any sub-index of the OD entry */
+    uint32_t write; /**< Number of completed writes to any sub-index of the OD entry */
+} OD_profile_t;
+#endif
+
 /**
  * IO stream structure, used for read/write access to OD variable, part of @ref OD_IO_t.
  */
@@ -172,6 +190,9 @@ typedef struct {
     OD_attr_t attribute;  /**< Attribute bit-field of the OD sub-object, see @ref OD_attributes_t */
     uint16_t index;       /**< Index of the OD object, informative */
     uint8_t subIndex;     /**< Sub index of the OD sub-object, informative */
+#if (((CO_CONFIG_OD)&CO_CONFIG_OD_PROFILE) != 0) || defined CO_DOXYGEN
+    OD_profile_t* profile; /**< Access counters of the OD entry, set by @ref OD_getSub() */
+#endif
 } OD_stream_t;
 
 /**
@@ -639,8 +660,251 @@ OD_set_f64(const OD_entry_t* entry, uint8_t subIndex, float64_t val, bool_t odOr
  * @return Pointer to variable in Object Dictionary or NULL in case of error.
  */
 void* OD_getPtr(const OD_entry_t* entry, uint8_t subIndex, OD_size_t len, ODR_t* err);
+
+/**
+ * Descriptor of one variable for @ref OD_readMany() and @ref OD_writeMany().
+ */
+typedef struct {
+    uint16_t index;   /**< Index of the OD object */
+    uint8_t subIndex; /**< Sub-index of the variable */
+    void* buf;        /**< Buffer for data read or data to be written */
+    OD_size_t len;    /**< Size of buf on input. Count of bytes actually read or written on output. */
+    ODR_t ret;        /**< Result of access to this variable, set by function */
+} OD_multiItem_t;
+
+/**
+ * Read multiple variables from Object Dictionary
+ *
+ * Items should be sorted by index (and sub-index). They are then resolved in a single pass over the sorted Object
+ * Dictionary, each @ref OD_find() searches only the rest of the list. Unsorted items are also accepted, but search is
+ * slower. All variables are read inside single CO_LOCK_OD() section, so they are consistent.
+ *
+ * Each variable is read with single read call, as in @ref OD_get_value(). If buffer is smaller than the variable, then
+ * first part of data is read and item result is ODR_PARTIAL.
+ *
+ * @param od Object Dictionary.
+ * @param items Array of items. Result and count of bytes read are written into each item.
+ * @param count Number of items.
+ * @param odOrig If true, then potential IO extensions on entries will be ignored.
+ * @param CANmodule CAN module, used as argument for CO_LOCK_OD() macro.
+ *
+ * @return "ODR_OK" if all items were read successfully, otherwise result of the first erroneous item.
+ */
+ODR_t OD_readMany(OD_t* od, OD_multiItem_t* items, uint16_t count, bool_t odOrig, CO_CANmodule_t* CANmodule);
+
+/**
+ * Write multiple variables into Object Dictionary
+ *
+ * Same principles as in @ref OD_readMany() apply. All variables are written inside single CO_LOCK_OD() section. Length
+ * of each item must match length of the variable, except for variables of unspecified length (domains). Erroneous item
+ * does not stop writing of other items.
+ *
+ * @param od Object Dictionary.
+ * @param items Array of items. Result and count of bytes written are written into each item.
+ * @param count Number of items.
+ * @param odOrig If true, then potential IO extensions on entries will be ignored.
+ * @param CANmodule CAN module, used as argument for CO_LOCK_OD() macro.
+ *
+ * @return "ODR_OK" if all items were written successfully, otherwise result of the first erroneous item.
+ */
+ODR_t OD_writeMany(OD_t* od, OD_multiItem_t* items, uint16_t count, bool_t odOrig, CO_CANmodule_t* CANmodule);
+
+/**
+ * Read range of elements from OD array
+ *
+ * Function reads sub-indexes from subIndexFirst to (subIndexFirst + subCount - 1) of the OD object of type ODT_ARR in
+ * one call. Elements are packed into buf one after another, each with length of the array element, in CANopen (little
+ * endian) byte order, as transferred by SDO. If elements are stored contiguously in the original OD location, data is
+ * copied with single memcpy(). On big endian machines elements of multi-byte type are swapped after the copy.
+ *
+ * If OD entry has IO extension and odOrig is false, elements are read one by one with extension read function.
+ *
+ * Access attributes of the array are not verified, this is responsibility of the caller.
+ *
+ * @param entry OD entry of type ODT_ARR.
+ * @param subIndexFirst Sub-index of the first element, 1 or more.
+ * @param subCount Number of elements to read.
+ * @param [out] buf Buffer for data.
+ * @param count Size of the buffer, must be at least subCount * element length.
+ * @param [out] countRead Number of bytes written into buf.
+ * @param odOrig If true, then potential IO extension on entry will be ignored.
+ *
+ * @return Value from @ref ODR_t, "ODR_OK" in case of success, "ODR_UNSUPP_ACCESS" if entry is not an array with
+ * elements of specified length, "ODR_SUB_NOT_EXIST" if range is out of array, "ODR_DATA_SHORT" if count is smaller
+ * than subCount * element length, same as in @ref OD_writeArray().
+ */
+ODR_t OD_readArray(const OD_entry_t* entry, uint8_t subIndexFirst, uint8_t subCount, void* buf, OD_size_t count,
+                   OD_size_t* countRead, bool_t odOrig);
+
+/**
+ * Write range of elements into OD array
+ *
+ * Same principles as in @ref OD_readArray() apply. Size of the data must be exactly subCount * element length.
+ *
+ * @param entry OD entry of type ODT_ARR.
+ * @param subIndexFirst Sub-index of the first element, 1 or more.
+ * @param subCount Number of elements to write.
+ * @param buf Packed data in CANopen (little endian) byte order.
+ * @param count Size of the data in buf.
+ * @param odOrig If true, then potential IO extension on entry will be ignored.
+ *
+ * @return Value from @ref ODR_t, "ODR_OK" in case of success, "ODR_DATA_LONG" or "ODR_DATA_SHORT" if count does not
+ * match.
+ */
+ODR_t OD_writeArray(const OD_entry_t* entry, uint8_t subIndexFirst, uint8_t subCount, const void* buf,
+                    OD_size_t count, bool_t odOrig);
 /** @} */ /* CO_ODgetSetters */
 
+#if (((CO_CONFIG_OD)&CO_CONFIG_OD_ARRAY_DOMAIN) != 0) || defined CO_DOXYGEN
+/**
+ * @defgroup CO_ODarrayDomain OD array as domain
+ * @{
+ *
+ * Whole OD array served as single domain, enabled with CO_CONFIG_OD_ARRAY_DOMAIN.
+ *
+ * Application defines an additional OD variable of type DOMAIN, for example on index 0x2F20, readable by SDO. After
+ * @ref OD_arrayDomain_init() SDO upload of that variable returns all elements of the linked OD array (sub-indexes from
+ * 1 to the last), packed one after another. Data is read with @ref OD_readArray() in chunks, as large as SDO server
+ * buffer, so the whole array is transferred with single segmented or block upload instead of one SDO transfer per
+ * sub-index. Size of the data is indicated to the SDO client. Download of the domain is not supported, application
+ * can use @ref OD_writeArray().
+ *
+ * Read function of the domain behaves as OD_readOriginal(): it returns "ODR_PARTIAL" until all data is read. If the
+ * buffer is smaller than one element, element is read in several parts, so elements larger than SDO server buffer can
+ * also be transferred.
+ */
+
+/**
+ * Object for OD domain, which provides access to OD array.
+ */
+typedef struct {
+    OD_entry_t* array;        /**< From OD_arrayDomain_init() */
+    OD_extension_t extension; /**< Extension for the OD domain */
+} OD_arrayDomain_t;
+
+/**
+ * Initialize OD domain for access to OD array.
+ *
+ * @param arrayDomain This object will be initialized.
+ * @param OD_array OD entry of type ODT_ARR, which will be served.
+ * @param OD_domain OD variable of type DOMAIN.
+ *
+ * @return "ODR_OK" on success, "ODR_IDX_NOT_EXIST" if OD_domain is NULL or "ODR_DEV_INCOMPAT".
+ */
+ODR_t OD_arrayDomain_init(OD_arrayDomain_t* arrayDomain, OD_entry_t* OD_array, OD_entry_t* OD_domain);
+
+/** @} */ /* CO_ODarrayDomain */
+#endif /* (CO_CONFIG_OD) & CO_CONFIG_OD_ARRAY_DOMAIN */
+
+#if (((CO_CONFIG_OD)&CO_CONFIG_OD_PROFILE) != 0) || defined CO_DOXYGEN
+/**
+ * @defgroup CO_ODprofile OD access profiling
+ * @{
+ *
+ * Read and write counters for each OD entry, enabled with CO_CONFIG_OD_PROFILE.
+ *
+ * Counters are kept in array of @ref OD_profile_t in RAM, one element for each entry of the Object Dictionary, at the
+ * same position as entry in the OD list. OD entries may be located in read-only memory, so they are not modified.
+ * Application provides the array with @ref OD_profileInit(). Only one Object Dictionary can be profiled at a time.
+ *
+ * @ref OD_getSub() links the stream with the counters of the OD entry. Counters are incremented by @ref
+ * OD_readOriginal() and @ref OD_writeOriginal(), when read or write of the OD variable is completed. This covers SDO
+ * and PDO access (with CO_CONFIG_PDO_OD_IO_ACCESS) and application access with getters and setters. IO extensions,
+ * which do not call original read / write functions, and direct copy runs of CO_CONFIG_PDO_COPY_PLAN are not counted.
+ *
+ * Counters can be inspected with @ref OD_profileGetTop(), with manufacturer specific OD record, see @ref
+ * OD_profileObj_init(), or with gateway command "_odprof".
+ */
+
+/**
+ * Start profiling of the Object Dictionary.
+ *
+ * Function clears the counters and links them with the OD. It replaces Object Dictionary profiled before.
+ *
+ * @param od Object Dictionary, which will be profiled.
+ * @param counters Array of counters, must exist permanently. Element at position i is used for od->list[i].
+ * @param countersSize Number of elements in counters, must be at least od->size.
+ *
+ * @return "ODR_OK" on success or "ODR_DEV_INCOMPAT", if arguments are wrong.
+ */
+ODR_t OD_profileInit(OD_t* od, OD_profile_t counters[], uint16_t countersSize);
+
+/**
+ * Get access counters of the OD entry.
+ *
+ * @param entry OD entry.
+ *
+ * @return Pointer to counters or NULL, if entry is not part of the Object Dictionary given to @ref OD_profileInit().
+ */
+const OD_profile_t* OD_profileGet(const OD_entry_t* entry);
+
+/**
+ * Get OD entry at specified rank, ordered by sum of read and write counters.
+ *
+ * Function searches the whole Object Dictionary rank + 1 times, so it is intended for diagnostics only.
+ *
+ * @param od Object Dictionary.
+ * @param rank Position in ordered list, 0 for most accessed entry.
+ *
+ * @return Pointer to OD entry or NULL, if there are not enough accessed entries.
+ */
+OD_entry_t* OD_profileGetTop(OD_t* od, uint16_t rank);
+
+/**
+ * Get list of most accessed OD entries, ordered by sum of read and write counters.
+ *
+ * Same order as in @ref OD_profileGetTop(), but function searches the Object Dictionary only once. Use it to get more
+ * than one entry.
+ *
+ * @param od Object Dictionary.
+ * @param [out] top Array for count pointers to OD entries, most accessed first.
+ * @param count Size of the top array.
+ *
+ * @return Number of entries written into top, less than count, if there are not enough accessed entries.
+ */
+uint16_t OD_profileGetTopList(OD_t* od, OD_entry_t* top[], uint16_t count);
+
+/**
+ * Clear access counters of all OD entries.
+ *
+ * @param od Object Dictionary.
+ */
+void OD_profileReset(OD_t* od);
+
+/**
+ * Object for manufacturer specific OD record, which provides access to OD profile.
+ */
+typedef struct {
+    OD_t* od;                 /**< From OD_profileObj_init() */
+    OD_extension_t extension; /**< Extension for the OD record */
+    uint8_t rank;             /**< Selected rank, written on sub-index 1 */
+    OD_entry_t* top[CO_CONFIG_OD_PROFILE_TOP_COUNT]; /**< Most accessed entries, collected when rank is written */
+    uint16_t topCount;                               /**< Number of valid entries in top */
+} OD_profileObj_t;
+
+/**
+ * Initialize OD record for access to OD profile.
+ *
+ * OD record must be defined by application, for example on index 0x2F10, with the following structure:
+ * - Sub index 0: Highest sub-index supported, UNSIGNED8, value 4
+ * - Sub index 1: Rank, UNSIGNED8, readable and writable. Write 1 to select the most accessed entry, 2 for the next
+ *   one, etc., up to CO_CONFIG_OD_PROFILE_TOP_COUNT. Write 0 to clear all counters. Most accessed entries are
+ *   collected in one pass over the Object Dictionary, when rank is written. Write it again to refresh them.
+ * - Sub index 2: Index of the OD entry at selected rank or 0, UNSIGNED16, read only
+ * - Sub index 3: Read counter of the OD entry at selected rank, UNSIGNED32, read only
+ * - Sub index 4: Write counter of the OD entry at selected rank, UNSIGNED32, read only
+ *
+ * @param profileObj This object will be initialized.
+ * @param od Object Dictionary, which will be profiled.
+ * @param OD_profileRecord OD record with the above structure.
+ *
+ * @return "ODR_OK" on success, "ODR_IDX_NOT_EXIST" if OD_profileRecord is NULL or "ODR_DEV_INCOMPAT".
+ */
+ODR_t OD_profileObj_init(OD_profileObj_t* profileObj, OD_t* od, OD_entry_t* OD_profileRecord);
+
+/** @} */ /* CO_ODprofile */
+#endif /* (CO_CONFIG_OD) & CO_CONFIG_OD_PROFILE */
+
 #if defined OD_DEFINITION || defined CO_DOXYGEN
 /**
  * @defgroup CO_ODdefinition OD definition objects
@@ -664,6 +928,11 @@ typedef enum {
                        can have own type and own attribute. OD object is an array of elements of type @ref OD_obj_var_t.
                        Variable at sub-index 0 is of type uint8_t and usually represents number of sub-elements in the
                        structure. */
+    ODT_RECF = 0x04, /**< This type also corresponds to CANopen Object Dictionary object with object code equal to
+                        RECORD. It is a compact alternative to ODT_REC for families of records with the same structure,
+                        for example PDO communication and mapping parameters. OD object is type of @ref
+                        OD_obj_recordFamily_t, which may be shared by all OD entries of the family. Descriptions of
+                        sub-elements are shared in @ref OD_obj_recordSub_t template. */
     ODT_TYPE_MASK = 0x0F, /**< Mask for basic type */
 } OD_objectTypes_t;
 
@@ -698,6 +967,31 @@ typedef struct {
     OD_size_t dataLength; /**< Data length in bytes */
 } OD_obj_record_t;
 
+/**
+ * Template for OD sub-element, used in "RECORD" type OD objects of type @ref ODT_RECF
+ *
+ * Contains no pointers, so the same template may be shared by many records.
+ */
+typedef struct {
+    OD_size_t dataLength; /**< Data length in bytes */
+    uint16_t dataOffset;  /**< Offset of data from the beginning of the record data structure */
+    uint8_t subIndex;     /**< Sub index of element. */
+    OD_attr_t attribute;  /**< Attribute bitfield, see @ref OD_attributes_t */
+} OD_obj_recordSub_t;
+
+/**
+ * Object for family of OD records with the same structure, used for "RECORD" type OD objects of type @ref ODT_RECF
+ *
+ * Data structures of records in family are located in memory with constant stride. Data of OD entry with index
+ * "entry->index" are located at "dataOrig + (entry->index - indexFirst) * stride". Single record uses stride 0.
+ */
+typedef struct {
+    void* dataOrig;                      /**< Pointer to data structure of the first record in family */
+    OD_size_t stride;                    /**< Distance between data structures of consecutive records in bytes */
+    uint16_t indexFirst;                 /**< OD index of the first record in family */
+    CO_PROGMEM OD_obj_recordSub_t* subs; /**< Array of sub-element templates, entry->subEntriesCount elements */
+} OD_obj_recordFamily_t;
+
 /** @} */ /* CO_ODdefinition */
 
 #endif /* defined OD_DEFINITION */
@@ -30,10 +30,63 @@
 #endif
 #endif
 
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_COPY_PLAN) != 0
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_OD_IO_ACCESS) == 0
+#error PDO copy plan is not possible without CO_CONFIG_PDO_OD_IO_ACCESS
+#endif
+#endif
+
+#if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_COS) != 0
+#if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_TIMERS_ENABLE) == 0
+#error TPDO change of value is not possible without CO_CONFIG_TPDO_TIMERS_ENABLE
+#endif
+#endif
+
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_MPDO) != 0
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_OD_IO_ACCESS) == 0
+#error MPDO is not possible without CO_CONFIG_PDO_OD_IO_ACCESS
+#endif
+#if CO_PDO_MAX_SIZE < 8U
+#error MPDO requires CO_PDO_MAX_SIZE of at least 8 bytes
+#endif
+/* Length of MPDO in units of PDO_common.dataLength */
 #if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_BITWISE_MAPPING) != 0
+#define CO_PDO_MPDO_LENGTH 64U
+#else
+#define CO_PDO_MPDO_LENGTH 8U
+#endif
+#endif
+
+#if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_SYNC_BALANCE) != 0
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_SYNC_ENABLE) == 0
+#error TPDO SYNC balancing is not possible without CO_CONFIG_PDO_SYNC_ENABLE
+#endif
+/* Maximum number of SYNC periods, over which load is calculated, if hyperperiod of PDOs is longer. */
+#define CO_PDO_SYNC_BALANCE_HORIZON_MAX 0xFFFFU
+#endif
+
+#if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_LATENCY) != 0
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_SYNC_ENABLE) == 0
+#error TPDO latency measurement is not possible without CO_CONFIG_PDO_SYNC_ENABLE
+#endif
+/* Sub-index of the first histogram bin in latency OD record */
+#define CO_TPDO_LATENCY_OD_HIST 10U
+#endif
+
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_STAGED_MAPPING) != 0
+#if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_OD_IO_ACCESS) == 0) || (((CO_CONFIG_PDO)&CO_CONFIG_FLAG_OD_DYNAMIC) == 0)
+#error Staged PDO mapping is not possible without CO_CONFIG_PDO_OD_IO_ACCESS and CO_CONFIG_FLAG_OD_DYNAMIC
+#endif
+#endif
+
+/* Cold data of the PDO (OD_IO[] and configuration) is inside CO_PDO_common_t or in separate CO_PDO_cold_t */
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_COLD_SPLIT) != 0
 #if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_OD_IO_ACCESS) == 0
-#error Bitwise PDO mapping is not possible without CO_CONFIG_PDO_OD_IO_ACCESS
+#error Cold PDO data split is not possible without CO_CONFIG_PDO_OD_IO_ACCESS
 #endif
+#define CO_PDO_COLD(PDO) ((PDO)->cold)
+#else
+#define CO_PDO_COLD(PDO) (PDO)
 #endif
 
 #if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_OD_IO_ACCESS) != 0
@@ -90,19 +143,28 @@ PDOconfigMap(CO_PDO_common_t* PDO, uint32_t map, uint8_t mapIndex, bool_t isRPDO
     uint8_t subIndex = (uint8_t)(map >> 8);
     uint8_t mappedLengthBits = (uint8_t)map;
     uint8_t mappedLength = mappedLengthBits >> 3;
-    OD_IO_t* OD_IO = &PDO->OD_IO[mapIndex];
+    OD_IO_t* OD_IO = &CO_PDO_COLD(PDO)->OD_IO[mapIndex];
 
     /* total PDO length can not be more than CO_PDO_MAX_SIZE bytes */
     if (mappedLength > CO_PDO_MAX_SIZE) {
         return ODR_MAP_LEN; /* PDO length exceeded */
     }
 
-    /* is there a reference to the dummy entry */
+    /* is there a reference to the dummy entry, it occupies mappedLengthBits, the same as with direct access */
     if ((index < 0x20U) && (subIndex == 0U)) {
         OD_stream_t* stream = &OD_IO->stream;
+#if ((CO_CONFIG_PDO) & (CO_CONFIG_PDO_BITWISE_MAPPING)) != 0
+        (void)memset(stream, 0, sizeof(OD_stream_t));
+        stream->dataLength = ((OD_size_t)mappedLengthBits + 7U) >> 3;
+        stream->dataOffset = mappedLengthBits;
+#else
+        if ((mappedLengthBits & 0x07U) != 0U) {
+            return ODR_NO_MAP;
+        }
         (void)memset(stream, 0, sizeof(OD_stream_t));
         stream->dataLength = mappedLength;
         stream->dataOffset = mappedLength;
+#endif
         OD_IO->read = OD_read_dummy;
         OD_IO->write = OD_write_dummy;
         return ODR_OK;
@@ -153,6 +215,167 @@ PDOconfigMap(CO_PDO_common_t* PDO, uint32_t map, uint8_t mapIndex, bool_t isRPDO
     return ODR_OK;
 }
 
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_MPDO) != 0
+/*
+ * Configure PDO as MPDO
+ *
+ * Called when mapping parameter, sub-index 0 is CO_PDO_MPDO_SAM or CO_PDO_MPDO_DAM. DAM TPDO transmits OD variable,
+ * mapped with sub-index 1, which must be up to 4 bytes long. Other MPDOs have no mapped objects.
+ *
+ * @param PDO This object.
+ * @param mpdoMode CO_PDO_MPDO_SAM or CO_PDO_MPDO_DAM.
+ * @param isRPDO True for RPDO and false for TPDO.
+ *
+ * @return ODR_OK on success, PDO is updated then.
+ */
+static ODR_t
+PDO_configMPDO(CO_PDO_common_t* PDO, uint8_t mpdoMode, bool_t isRPDO) {
+    uint8_t mappedObjectsCount = 0;
+
+    if (!isRPDO && (mpdoMode == (uint8_t)CO_PDO_MPDO_DAM)) {
+        const OD_IO_t* OD_IO = &CO_PDO_COLD(PDO)->OD_IO[0];
+        OD_size_t mappedLength = OD_IO->stream.dataOffset;
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_BITWISE_MAPPING) != 0
+        if ((mappedLength & 0x07U) != 0U) {
+            return ODR_NO_MAP;
+        }
+        mappedLength /= 8U;
+#endif
+        if ((OD_IO->read == OD_read_dummy) || (mappedLength == 0U) || (OD_IO->stream.dataLength < mappedLength)
+            || (OD_IO->stream.dataLength > 4U)) {
+            return ODR_NO_MAP;
+        }
+        mappedObjectsCount = 1;
+    }
+
+    PDO->dataLength = (CO_PDO_size_t)CO_PDO_MPDO_LENGTH;
+    PDO->mappedObjectsCount = mappedObjectsCount;
+    PDO->mpdoMode = mpdoMode;
+    return ODR_OK;
+}
+
+#ifdef CO_BIG_ENDIAN
+/*
+ * Reverse byte order of MPDO data
+ */
+static void
+PDO_swapMPDO(uint8_t* data, OD_size_t length) {
+    uint8_t* lo = data;
+    uint8_t* hi = data + length - 1U;
+    while (lo < hi) {
+        uint8_t swap = *lo;
+        *lo++ = *hi;
+        *hi-- = swap;
+    }
+}
+#endif
+#endif /* (CO_CONFIG_PDO) & CO_CONFIG_PDO_MPDO */
+
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_COPY_PLAN) != 0
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_BITWISE_MAPPING) != 0
+/*
+ * Compile copy plan from PDO bitwise mapping
+ *
+ * Called when mapping is enabled. Shift and mask are calculated for each mapped entry. Entries, which have no IO
+ * extension, are accessed directly.
+ *
+ * @param PDO This object.
+ * @param isRPDO True for RPDO and false for TPDO.
+ */
+static void
+PDO_compilePlan(CO_PDO_common_t* PDO, bool_t isRPDO) {
+    uint8_t shift = 0;
+
+    for (uint8_t i = 0; i < PDO->mappedObjectsCount; i++) {
+        OD_IO_t* OD_IO = &CO_PDO_COLD(PDO)->OD_IO[i];
+        OD_stream_t* stream = &OD_IO->stream;
+        CO_PDO_copyRun_t* run = &PDO->copyRun[i];
+        uint8_t mappedLengthBits = (uint8_t)stream->dataOffset;
+
+        /* length of OD variable may be larger than mappedLength */
+        OD_size_t ODdataLength = stream->dataLength;
+        if (ODdataLength > CO_PDO_MAX_SIZE) {
+            ODdataLength = CO_PDO_MAX_SIZE;
+        }
+
+        run->dataOD = NULL;
+        if ((isRPDO ? (OD_IO->write == OD_writeOriginal) : (OD_IO->read == OD_readOriginal))
+            && (stream->dataOrig != NULL)) {
+            run->dataOD = stream->dataOrig;
+        }
+        run->mask = (mappedLengthBits > 0U) ? (UINT64_MAX >> (64U - mappedLengthBits)) : 0U;
+        run->shift = (mappedLengthBits > 0U) ? shift : 0U;
+        run->bits = mappedLengthBits;
+        run->length = (uint8_t)ODdataLength;
+#ifdef CO_BIG_ENDIAN
+        /* Least significant bytes of the OD variable are at the end of uint64_t */
+        run->valueOffset = (uint8_t)(sizeof(uint64_t) - ODdataLength);
+#else
+        run->valueOffset = 0;
+#endif
+        run->mapIndex = i;
+        shift += mappedLengthBits;
+    }
+    PDO->copyRunsCount = PDO->mappedObjectsCount;
+}
+#else
+/*
+ * Compile copy plan from PDO mapping
+ *
+ * Called when mapping is enabled. Mapped entries, which have no IO extension and are fully mapped, are accessed
+ * directly. Adjacent entries are merged into single run.
+ *
+ * @param PDO This object.
+ * @param isRPDO True for RPDO and false for TPDO.
+ */
+static void
+PDO_compilePlan(CO_PDO_common_t* PDO, bool_t isRPDO) {
+    CO_PDO_copyRun_t* run = NULL;
+    uint8_t offset = 0;
+
+    PDO->copyRunsCount = 0;
+
+    for (uint8_t i = 0; i < PDO->mappedObjectsCount; i++) {
+        OD_IO_t* OD_IO = &CO_PDO_COLD(PDO)->OD_IO[i];
+        OD_stream_t* stream = &OD_IO->stream;
+        uint8_t mappedLength = (uint8_t)stream->dataOffset;
+        uint8_t* dataOD = NULL;
+        bool_t swap = false;
+
+        /* Direct access is possible, if OD_IO functions are original and variable is fully mapped */
+        if (isRPDO ? (OD_IO->write == OD_writeOriginal) : (OD_IO->read == OD_readOriginal)) {
+            if ((stream->dataOrig != NULL) && (stream->dataLength == (OD_size_t)mappedLength)) {
+                dataOD = stream->dataOrig;
+            }
+        }
+#ifdef CO_BIG_ENDIAN
+        swap = (dataOD != NULL) && ((stream->attribute & ODA_MB) != 0U) && (mappedLength > 1U);
+#endif
+
+        /* merge with previous run, if possible, otherwise start new run */
+        if ((run != NULL) && (dataOD != NULL) && (run->dataOD != NULL) && !swap
+#ifdef CO_BIG_ENDIAN
+            && !run->swap
+#endif
+            && ((run->dataOD + run->length) == dataOD)) {
+            run->length += mappedLength;
+        } else {
+            run = &PDO->copyRun[PDO->copyRunsCount];
+            PDO->copyRunsCount++;
+            run->dataOD = dataOD;
+            run->offset = offset;
+            run->length = mappedLength;
+            run->mapIndex = i;
+#ifdef CO_BIG_ENDIAN
+            run->swap = swap;
+#endif
+        }
+        offset += mappedLength;
+    }
+}
+#endif /* (CO_CONFIG_PDO) & CO_CONFIG_PDO_BITWISE_MAPPING */
+#endif /* (CO_CONFIG_PDO) & CO_CONFIG_PDO_COPY_PLAN */
+
 /*
  * Initialize PDO mapping parameters
  *
@@ -182,7 +405,7 @@ PDO_initMapping(CO_PDO_common_t* PDO, OD_t* OD, OD_entry_t* OD_PDOMapPar, bool_t
     }
 
     for (uint8_t i = 0; i < CO_PDO_MAX_MAPPED_ENTRIES; i++) {
-        OD_IO_t* OD_IO = &PDO->OD_IO[i];
+        OD_IO_t* OD_IO = &CO_PDO_COLD(PDO)->OD_IO[i];
         uint32_t map = 0;
 
         odRet = OD_get_u32(OD_PDOMapPar, i + 1U, &map, true);
@@ -210,6 +433,18 @@ PDO_initMapping(CO_PDO_common_t* PDO, OD_t* OD, OD_entry_t* OD_PDOMapPar, bool_t
             pdoDataLength += OD_IO->stream.dataOffset;
         }
     }
+
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_MPDO) != 0
+    if ((mappedObjectsCount == (uint8_t)CO_PDO_MPDO_SAM) || (mappedObjectsCount == (uint8_t)CO_PDO_MPDO_DAM)) {
+        if ((*erroneousMap == 0U) && (PDO_configMPDO(PDO, mappedObjectsCount, isRPDO) != ODR_OK)) {
+            *erroneousMap = 1;
+        }
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_COPY_PLAN) != 0
+        PDO->copyRunsCount = 0;
+#endif
+        return CO_ERROR_NO;
+    }
+#endif
 #if ((CO_CONFIG_PDO) & (CO_CONFIG_PDO_BITWISE_MAPPING)) != 0
     if ((pdoDataLength > CO_PDO_MAX_SIZE * 8) || ((pdoDataLength == 0U) && (mappedObjectsCount > 0U))) {
 #else
@@ -223,6 +458,12 @@ PDO_initMapping(CO_PDO_common_t* PDO, OD_t* OD, OD_entry_t* OD_PDOMapPar, bool_t
     if (*erroneousMap == 0U) {
         PDO->dataLength = (CO_PDO_size_t)pdoDataLength;
         PDO->mappedObjectsCount = mappedObjectsCount;
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_MPDO) != 0
+        PDO->mpdoMode = 0;
+#endif
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_COPY_PLAN) != 0
+        PDO_compilePlan(PDO, isRPDO);
+#endif
     }
 
     return CO_ERROR_NO;
@@ -245,7 +486,11 @@ OD_write_PDO_mapping(OD_stream_t* stream, const void* buf, OD_size_t count, OD_s
     CO_PDO_common_t* PDO = stream->object;
 
     /* PDO must be disabled before mapping configuration */
-    if ((PDO->valid) || ((PDO->mappedObjectsCount != 0U) && (stream->subIndex > 0U))) {
+    bool_t mappingEnabled = PDO->mappedObjectsCount != 0U;
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_MPDO) != 0
+    mappingEnabled = mappingEnabled || (PDO->mpdoMode != 0U);
+#endif
+    if ((PDO->valid) || (mappingEnabled && (stream->subIndex > 0U))) {
         return ODR_UNSUPP_ACCESS;
     }
 
@@ -253,13 +498,25 @@ OD_write_PDO_mapping(OD_stream_t* stream, const void* buf, OD_size_t count, OD_s
         uint8_t mappedObjectsCount = CO_getUint8(buf);
         size_t pdoDataLength = 0;
 
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_MPDO) != 0
+        if ((mappedObjectsCount == (uint8_t)CO_PDO_MPDO_SAM) || (mappedObjectsCount == (uint8_t)CO_PDO_MPDO_DAM)) {
+            ODR_t odRet = PDO_configMPDO(PDO, mappedObjectsCount, CO_PDO_COLD(PDO)->isRPDO);
+            if (odRet != ODR_OK) {
+                return odRet;
+            }
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_COPY_PLAN) != 0
+            PDO->copyRunsCount = 0;
+#endif
+            return OD_writeOriginal(stream, buf, count, countWritten);
+        }
+#endif
         if (mappedObjectsCount > CO_PDO_MAX_MAPPED_ENTRIES) {
             return ODR_MAP_LEN;
         }
 
         /* validate enabled mapping parameters */
         for (uint8_t i = 0; i < mappedObjectsCount; i++) {
-            OD_IO_t* OD_IO = &PDO->OD_IO[i];
+            OD_IO_t* OD_IO = &CO_PDO_COLD(PDO)->OD_IO[i];
             size_t dataLength = (size_t)OD_IO->stream.dataLength;
             size_t mappedLength = (size_t)OD_IO->stream.dataOffset;
 
@@ -288,9 +545,15 @@ OD_write_PDO_mapping(OD_stream_t* stream, const void* buf, OD_size_t count, OD_s
         /* success, update PDO */
         PDO->dataLength = (CO_PDO_size_t)pdoDataLength;
         PDO->mappedObjectsCount = mappedObjectsCount;
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_MPDO) != 0
+        PDO->mpdoMode = 0;
+#endif
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_COPY_PLAN) != 0
+        PDO_compilePlan(PDO, CO_PDO_COLD(PDO)->isRPDO);
+#endif
     } else {
         uint32_t val = CO_getUint32(buf);
-        ODR_t odRet = PDOconfigMap(PDO, val, stream->subIndex - 1U, PDO->isRPDO, PDO->OD);
+        ODR_t odRet = PDOconfigMap(PDO, val, stream->subIndex - 1U, CO_PDO_COLD(PDO)->isRPDO, CO_PDO_COLD(PDO)->OD);
         if (odRet != ODR_OK) {
             return odRet;
         }
@@ -300,12 +563,165 @@ OD_write_PDO_mapping(OD_stream_t* stream, const void* buf, OD_size_t count, OD_s
     return OD_writeOriginal(stream, buf, count, countWritten);
 }
 #endif /* (CO_CONFIG_PDO) & CO_CONFIG_FLAG_OD_DYNAMIC */
+
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_STAGED_MAPPING) != 0
+/*
+ * Verify new mapping and compile it into the shadow PDO
+ *
+ * Shadow is a copy of the PDO, so mapped entries, which are not changed, stay the same.
+ *
+ * @param PDO This object, it is not changed.
+ * @param stagedMap Staged mapping, see CO_RPDO_stageMapping().
+ * @param map Array of mappedObjectsCount new values of mapping parameter, sub-indexes 1...
+ * @param mappedObjectsCount Number of mapped objects, from 1 to CO_PDO_MAX_MAPPED_ENTRIES.
+ * @param CAN_ID New CAN identifier or 0, if it is not changed.
+ *
+ * @return ODR_OK on success, otherwise error reason.
+ */
+static ODR_t
+PDO_stageMapping(const CO_PDO_common_t* PDO, CO_PDO_stagedMap_t* stagedMap, const uint32_t* map,
+                 uint8_t mappedObjectsCount, uint16_t CAN_ID) {
+    CO_PDO_common_t* shadow = &stagedMap->shadow;
+    size_t pdoDataLength = 0;
+
+    if ((mappedObjectsCount == 0U) || (mappedObjectsCount > CO_PDO_MAX_MAPPED_ENTRIES) || (CAN_ID > 0x7FFU)
+        || ((CAN_ID != 0U) && CO_IS_RESTRICTED_CAN_ID(CAN_ID))) {
+        return ODR_INVALID_VALUE;
+    }
+
+    (void)memcpy((void*)shadow, (const void*)PDO, sizeof(CO_PDO_common_t));
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_COLD_SPLIT) != 0
+    (void)memcpy((void*)&stagedMap->shadowCold, (const void*)PDO->cold, sizeof(CO_PDO_cold_t));
+    shadow->cold = &stagedMap->shadowCold;
+#endif
+
+    for (uint8_t i = 0; i < mappedObjectsCount; i++) {
+        /* sub-index must exist in mapping parameter, so it can be written on swap */
+        uint32_t mapOD = 0;
+        ODR_t odRet = OD_get_u32(CO_PDO_COLD(PDO)->OD_mappingParam, i + 1U, &mapOD, true);
+        if (odRet == ODR_OK) {
+            odRet = PDOconfigMap(shadow, map[i], i, CO_PDO_COLD(PDO)->isRPDO, CO_PDO_COLD(PDO)->OD);
+        }
+        if (odRet != ODR_OK) {
+            return odRet;
+        }
+        pdoDataLength += CO_PDO_COLD(shadow)->OD_IO[i].stream.dataOffset;
+        stagedMap->map[i] = map[i];
+    }
+
+#if ((CO_CONFIG_PDO) & (CO_CONFIG_PDO_BITWISE_MAPPING)) != 0
+    if (pdoDataLength > CO_PDO_MAX_SIZE * 8) {
+#else
+    if (pdoDataLength > CO_PDO_MAX_SIZE) {
+#endif
+        return ODR_MAP_LEN;
+    }
+    if (pdoDataLength == 0U) {
+        return ODR_INVALID_VALUE;
+    }
+
+    shadow->dataLength = (CO_PDO_size_t)pdoDataLength;
+    shadow->mappedObjectsCount = mappedObjectsCount;
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_MPDO) != 0
+    shadow->mpdoMode = 0;
+#endif
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_COPY_PLAN) != 0
+    PDO_compilePlan(shadow, CO_PDO_COLD(PDO)->isRPDO);
+#endif
+    stagedMap->mappedObjectsCount = mappedObjectsCount;
+    stagedMap->CAN_ID = CAN_ID;
+
+    return ODR_OK;
+}
+
+/*
+ * Swap staged mapping into the PDO
+ *
+ * Mapping from the shadow PDO is copied into the PDO and new values are written into the original locations of mapping
+ * and communication parameter in Object Dictionary. CAN buffer is not changed.
+ *
+ * @param PDO This object.
+ * @param stagedMap Staged mapping, see CO_RPDO_stageMapping().
+ *
+ * @return True, if CAN identifier must be changed.
+ */
+static bool_t
+PDO_swapMapping(CO_PDO_common_t* PDO, const CO_PDO_stagedMap_t* stagedMap) {
+    const CO_PDO_common_t* shadow = &stagedMap->shadow;
+
+    (void)memcpy((void*)CO_PDO_COLD(PDO)->OD_IO, (const void*)CO_PDO_COLD(shadow)->OD_IO,
+                 sizeof(CO_PDO_COLD(PDO)->OD_IO));
+#if OD_FLAGS_PDO_SIZE > 0
+    (void)memcpy((void*)PDO->flagPDObyte, (const void*)shadow->flagPDObyte, sizeof(PDO->flagPDObyte));
+    (void)memcpy((void*)PDO->flagPDObitmask, (const void*)shadow->flagPDObitmask, sizeof(PDO->flagPDObitmask));
+#endif
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_COPY_PLAN) != 0
+    (void)memcpy((void*)PDO->copyRun, (const void*)shadow->copyRun, sizeof(PDO->copyRun));
+    PDO->copyRunsCount = shadow->copyRunsCount;
+#endif
+    PDO->dataLength = shadow->dataLength;
+    PDO->mappedObjectsCount = shadow->mappedObjectsCount;
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_MPDO) != 0
+    PDO->mpdoMode = 0;
+#endif
+
+    for (uint8_t i = 0; i < stagedMap->mappedObjectsCount; i++) {
+        (void)OD_set_u32(CO_PDO_COLD(PDO)->OD_mappingParam, i + 1U, stagedMap->map[i], true);
+    }
+    (void)OD_set_u8(CO_PDO_COLD(PDO)->OD_mappingParam, 0, stagedMap->mappedObjectsCount, true);
+
+    if ((stagedMap->CAN_ID == 0U) || (stagedMap->CAN_ID == CO_PDO_COLD(PDO)->configuredCanId)) {
+        return false;
+    }
+
+    /* keep upper bits of COB-ID, if default CAN-ID is written, store to OD without Node-ID */
+    uint32_t COB_ID = 0;
+    (void)OD_get_u32(CO_PDO_COLD(PDO)->OD_communicationParam, 1, &COB_ID, true);
+    COB_ID = (COB_ID & 0xFFFFF800U) | stagedMap->CAN_ID;
+    if (stagedMap->CAN_ID == CO_PDO_COLD(PDO)->preDefinedCanId) {
+        COB_ID &= 0xFFFFFF80U;
+    }
+    (void)OD_set_u32(CO_PDO_COLD(PDO)->OD_communicationParam, 1, COB_ID, true);
+
+    return true;
+}
+#endif /* (CO_CONFIG_PDO) & CO_CONFIG_PDO_STAGED_MAPPING */
 #endif /* (CO_CONFIG_PDO) & CO_CONFIG_PDO_OD_IO_ACCESS */
 
+#if defined CO_BIG_ENDIAN && (((CO_CONFIG_PDO)&CO_CONFIG_PDO_BITWISE_MAPPING) == 0)                                  \
+    && ((((CO_CONFIG_PDO)&CO_CONFIG_PDO_COPY_PLAN) != 0) || (((CO_CONFIG_PDO)&CO_CONFIG_PDO_OD_IO_ACCESS) == 0))
+/*
+ * Copy data in reverse byte order, used by copy plan and direct mapping for multi-byte variables
+ */
+static void
+PDO_copySwap(uint8_t* dst, const uint8_t* src, uint8_t length) {
+    for (uint8_t i = 0; i < length; i++) {
+        dst[i] = src[length - 1U - i];
+    }
+}
+#endif
+
 #if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_OD_IO_ACCESS) == 0
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_BITWISE_MAPPING) != 0
+/* Byte offset of OD data with length inside uint64_t value, least significant bytes are at the end on big endian */
+#ifdef CO_BIG_ENDIAN
+#define CO_PDO_VALUE_OFFSET(length) (sizeof(uint64_t) - (length))
+#else
+#define CO_PDO_VALUE_OFFSET(length) 0U
+#endif
+#endif
+
+/*
+ * Initialize PDO mapping parameters for direct access
+ *
+ * Each mapped entry gets pointer to the original OD location and its length, see @ref CO_PDO_directMap_t. Parameters
+ * are the same as for PDO_initMapping() with CO_CONFIG_PDO_OD_IO_ACCESS.
+ */
 static CO_ReturnError_t
 PDO_initMapping(CO_PDO_common_t* PDO, OD_t* OD, OD_entry_t* OD_PDOMapPar, bool_t isRPDO, uint32_t* errInfo,
                 uint32_t* erroneousMap) {
+    static uint8_t dummyTX[CO_PDO_MAX_SIZE];
+    static uint8_t dummyRX[CO_PDO_MAX_SIZE];
     ODR_t odRet;
     size_t pdoDataLength = 0;
 
@@ -325,6 +741,8 @@ PDO_initMapping(CO_PDO_common_t* PDO, OD_t* OD, OD_entry_t* OD_PDOMapPar, bool_t
 
     /* iterate mapped OD variables */
     for (uint8_t i = 0; i < mappedObjectsCount; i++) {
+        CO_PDO_directMap_t* directMap = &PDO->directMap[i];
+        uint8_t** dataOD = &PDO->directDataOD[i];
         uint32_t map = 0;
 
         odRet = OD_get_u32(OD_PDOMapPar, i + 1, &map, true);
@@ -337,22 +755,29 @@ PDO_initMapping(CO_PDO_common_t* PDO, OD_t* OD, OD_entry_t* OD_PDOMapPar, bool_t
         uint16_t index = (uint16_t)(map >> 16);
         uint8_t subIndex = (uint8_t)(map >> 8);
         uint8_t mappedLengthBits = (uint8_t)map;
-        uint8_t mappedLength = mappedLengthBits >> 3;
-        uint8_t pdoDataStart = pdoDataLength;
-        pdoDataLength += mappedLength;
+        pdoDataLength += mappedLengthBits;
 
-        if ((mappedLengthBits & 0x07) != 0 || pdoDataLength > CO_PDO_MAX_SIZE) {
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_BITWISE_MAPPING) != 0
+        /* number of bytes of OD variable, which contain mapped bits */
+        uint8_t mappedLength = (mappedLengthBits + 7U) >> 3;
+        if (pdoDataLength > (CO_PDO_MAX_SIZE * 8U)) {
+#else
+        uint8_t mappedLength = mappedLengthBits >> 3;
+        if (((mappedLengthBits & 0x07U) != 0U) || (pdoDataLength > (CO_PDO_MAX_SIZE * 8U))) {
+#endif
             *erroneousMap = map;
             return CO_ERROR_NO;
         }
 
         /* is there a reference to the dummy entry */
-        if (index < 0x20 && subIndex == 0) {
-            for (uint8_t j = pdoDataStart; j < pdoDataLength; j++) {
-                static uint8_t dummyTX = 0;
-                static uint8_t dummyRX;
-                PDO->mapPointer[j] = isRPDO ? &dummyRX : &dummyTX;
-            }
+        if ((index < 0x20U) && (subIndex == 0U)) {
+            *dataOD = isRPDO ? &dummyRX[0] : &dummyTX[0];
+            directMap->length = mappedLength;
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_BITWISE_MAPPING) != 0
+            directMap->bits = mappedLengthBits;
+#elif defined CO_BIG_ENDIAN
+            directMap->swap = 0;
+#endif
             continue;
         }
 
@@ -361,39 +786,49 @@ PDO_initMapping(CO_PDO_common_t* PDO, OD_t* OD, OD_entry_t* OD_PDOMapPar, bool_t
         OD_entry_t* entry = OD_find(OD, index);
         OD_attr_t testAttribute = isRPDO ? ODA_RPDO : ODA_TPDO;
 
-        ODR_t odRet = OD_getSub(entry, subIndex, &OD_IO, true);
-        if (odRet != ODR_OK || (OD_IO.stream.attribute & testAttribute) == 0 || OD_IO.stream.dataLength < mappedLength
-            || OD_IO.stream.dataOrig == NULL) {
+        odRet = OD_getSub(entry, subIndex, &OD_IO, true);
+        if ((odRet != ODR_OK) || ((OD_IO.stream.attribute & testAttribute) == 0U)
+            || (OD_IO.stream.dataLength < mappedLength) || (OD_IO.stream.dataOrig == NULL)) {
             *erroneousMap = map;
             return CO_ERROR_NO;
         }
 
-        /* write locations to OD variable data bytes into PDO map pointers */
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_BITWISE_MAPPING) != 0
+        /* whole OD variable, up to 64 bits, is copied into uint64_t value */
+        OD_size_t ODdataLength = OD_IO.stream.dataLength;
+        if (ODdataLength > CO_PDO_MAX_SIZE) {
+            ODdataLength = CO_PDO_MAX_SIZE;
+        }
+        *dataOD = OD_IO.stream.dataOrig;
+        directMap->length = (uint8_t)ODdataLength;
+        directMap->bits = mappedLengthBits;
+#else
+        /* only mapped bytes are copied, which are least significant bytes of the OD variable */
+        *dataOD = OD_IO.stream.dataOrig;
+        directMap->length = mappedLength;
 #ifdef CO_BIG_ENDIAN
-        if ((OD_IO.stream.attribute & ODA_MB) != 0) {
-            uint8_t* odDataPointer = OD_IO.stream.dataOrig + OD_IO.stream.dataLength - 1;
-            for (uint8_t j = pdoDataStart; j < pdoDataLength; j++) {
-                PDO->mapPointer[j] = odDataPointer--;
-            }
-        } else
-#endif
-        {
-            uint8_t* odDataPointer = OD_IO.stream.dataOrig;
-            for (uint8_t j = pdoDataStart; j < pdoDataLength; j++) {
-                PDO->mapPointer[j] = odDataPointer++;
-            }
+        directMap->swap = (((OD_IO.stream.attribute & ODA_MB) != 0U) && (mappedLength > 1U)) ? 1U : 0U;
+        if ((OD_IO.stream.attribute & ODA_MB) != 0U) {
+            *dataOD += OD_IO.stream.dataLength - mappedLength;
         }
+#endif
+#endif /* (CO_CONFIG_PDO) & CO_CONFIG_PDO_BITWISE_MAPPING */
 
         /* get TPDO request flag byte from extension */
 #if OD_FLAGS_PDO_SIZE > 0
-        if (!isRPDO && subIndex < (OD_FLAGS_PDO_SIZE * 8) && entry->extension != NULL) {
-            PDO->flagPDObyte[pdoDataStart] = &entry->extension->flagsPDO[subIndex >> 3];
-            PDO->flagPDObitmask[pdoDataStart] = 1 << (subIndex & 0x07);
+        if (!isRPDO && (subIndex < (OD_FLAGS_PDO_SIZE * 8U)) && (entry->extension != NULL)) {
+            PDO->flagPDObyte[i] = &entry->extension->flagsPDO[subIndex >> 3];
+            PDO->flagPDObitmask[i] = 1U << (subIndex & 0x07U);
         }
 #endif
     }
 
-    PDO->dataLength = PDO->mappedObjectsCount = pdoDataLength;
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_BITWISE_MAPPING) != 0
+    PDO->dataLength = (CO_PDO_size_t)pdoDataLength;
+#else
+    PDO->dataLength = (CO_PDO_size_t)(pdoDataLength >> 3);
+#endif
+    PDO->mappedObjectsCount = mappedObjectsCount;
     return CO_ERROR_NO;
 }
 
@@ -417,8 +852,8 @@ OD_read_PDO_commParam(OD_stream_t* stream, void* buf, OD_size_t count, OD_size_t
         uint16_t CAN_ID = (uint16_t)(COB_ID & 0x7FFU);
 
         /* If default CAN-ID is stored in OD (without Node-ID), add Node-ID */
-        if ((CAN_ID != 0U) && (CAN_ID == (PDO->preDefinedCanId & 0xFF80U))) {
-            COB_ID = (COB_ID & 0xFFFF0000U) | PDO->preDefinedCanId;
+        if ((CAN_ID != 0U) && (CAN_ID == (CO_PDO_COLD(PDO)->preDefinedCanId & 0xFF80U))) {
+            COB_ID = (COB_ID & 0xFFFF0000U) | CO_PDO_COLD(PDO)->preDefinedCanId;
         }
 
         /* If PDO is not valid, set bit 31 */
@@ -451,13 +886,27 @@ OD_read_PDO_commParam(OD_stream_t* stream, void* buf, OD_size_t count, OD_size_t
 
 /* @} */ /* CO_PDO_receiveErrors_t */
 
+#if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_RX_QUEUE) != 0
+/*
+ * Return true, if RPDO uses receive queue. Synchronous RPDOs use buffers selected by SYNC instead.
+ */
+static bool_t
+CO_RPDO_rxQueueUsed(const CO_RPDO_t* RPDO) {
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_SYNC_ENABLE) != 0
+    return (RPDO->rxQueue != NULL) && !RPDO->synchronous;
+#else
+    return RPDO->rxQueue != NULL;
+#endif
+}
+#endif
+
 /*
  * Read received frame from CAN module.
  *
  * Function will be called (by CAN receive interrupt) every time, when CAN frame with correct identifier
  * will be received. For more information and description of parameters see file CO_driver.h.
  * If new CAN frame arrives and previous frame wasn't processed yet, then
- * previous frame will be lost and overwritten by the new frame.
+ * previous frame will be lost and overwritten by the new frame, except if RPDO uses receive queue.
  */
 static void
 CO_PDO_receive(void* object, void* msg) {
@@ -496,9 +945,44 @@ CO_PDO_receive(void* object, void* msg) {
             }
 #endif
 
+#if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_RX_QUEUE) != 0
+            if (CO_RPDO_rxQueueUsed(RPDO)) {
+                /* copy data into the queue, if not full. CO_FLAG_SET also acts as memory barrier between data and
+                 * head of the queue. */
+                uint16_t head = RPDO->rxQueueHead;
+                uint16_t next = ((head + 1U) < RPDO->rxQueueSize) ? (head + 1U) : 0U;
+                if (next != RPDO->rxQueueTail) {
+                    (void)memcpy(RPDO->rxQueue[head], data, CO_PDO_MAX_SIZE);
+                    CO_FLAG_SET(RPDO->CANrxNew[bufNo]);
+                    RPDO->rxQueueHead = next;
+                } else {
+                    RPDO->rxOverrun++;
+                }
+            } else {
+                /* previous frame was not processed yet */
+                if (CO_FLAG_READ(RPDO->CANrxNew[bufNo])) {
+                    RPDO->rxOverrun++;
+                }
+                (void)memcpy(RPDO->CANrxData[bufNo], data, CO_PDO_MAX_SIZE);
+                CO_FLAG_SET(RPDO->CANrxNew[bufNo]);
+            }
+#else
             /* copy data into appropriate buffer and set 'new frame' flag */
             (void)memcpy(RPDO->CANrxData[bufNo], data, CO_PDO_MAX_SIZE);
             CO_FLAG_SET(RPDO->CANrxNew[bufNo]);
+#endif
+
+#if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_READY_LIST) != 0
+            /* put RPDO into the ready list, if not already there */
+            CO_RPDO_readyList_t* readyList = RPDO->readyList;
+            if ((readyList != NULL) && !CO_FLAG_READ(RPDO->readyQueued)) {
+                uint16_t head = readyList->head;
+                CO_FLAG_SET(RPDO->readyQueued);
+                readyList->queue[head] = RPDO->readyIndex;
+                CO_FLAG_SET(readyList->CANrxNew);
+                readyList->head = ((head + 1U) < readyList->queueSize) ? (head + 1U) : 0U;
+            }
+#endif
 
 #if ((CO_CONFIG_PDO)&CO_CONFIG_FLAG_CALLBACK_PRE) != 0
             /* Optional signal to RTOS, which can resume task, which handles the RPDO. */
@@ -541,32 +1025,35 @@ OD_write_14xx(OD_stream_t* stream, const void* buf, OD_size_t count, OD_size_t*
 
             /* bits 11...29 must be zero, PDO must be disabled on change, CAN_ID == 0 is
              * not allowed, mapping must be configured before enabling the PDO */
-            if (((COB_ID & 0x3FFFF800U) != 0U) || (valid && PDO->valid && (CAN_ID != PDO->configuredCanId))
-                || (valid && CO_IS_RESTRICTED_CAN_ID(CAN_ID)) || (valid && (PDO->mappedObjectsCount == 0U))) {
+            if (((COB_ID & 0x3FFFF800U) != 0U) || (valid && PDO->valid && (CAN_ID != CO_PDO_COLD(PDO)->configuredCanId))
+                || (valid && CO_IS_RESTRICTED_CAN_ID(CAN_ID)) || (valid && (PDO->dataLength == 0U))) {
                 return ODR_INVALID_VALUE;
             }
 
             /* parameter changed? */
-            if ((valid != PDO->valid) || (CAN_ID != PDO->configuredCanId)) {
+            if ((valid != PDO->valid) || (CAN_ID != CO_PDO_COLD(PDO)->configuredCanId)) {
                 /* if default CAN-ID is written, store to OD without Node-ID */
-                if (CAN_ID == PDO->preDefinedCanId) {
+                if (CAN_ID == CO_PDO_COLD(PDO)->preDefinedCanId) {
                     (void)CO_setUint32(bufCopy, COB_ID & 0xFFFFFF80U);
                 }
                 if (!valid) {
                     CAN_ID = 0;
                 }
 
-                CO_ReturnError_t ret = CO_CANrxBufferInit(PDO->CANdev, PDO->CANdevIdx, CAN_ID, 0x7FF, false,
-                                                          (void*)RPDO, CO_PDO_receive);
+                CO_ReturnError_t ret = CO_CANrxBufferInit(PDO->CANdev, CO_PDO_COLD(PDO)->CANdevIdx, CAN_ID, 0x7FF,
+                                                          false, (void*)RPDO, CO_PDO_receive);
 
                 if (valid && (ret == CO_ERROR_NO)) {
                     PDO->valid = true;
-                    PDO->configuredCanId = CAN_ID;
+                    CO_PDO_COLD(PDO)->configuredCanId = CAN_ID;
                 } else {
                     PDO->valid = false;
                     CO_FLAG_CLEAR(RPDO->CANrxNew[0]);
 #if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_SYNC_ENABLE) != 0
                     CO_FLAG_CLEAR(RPDO->CANrxNew[1]);
+#endif
+#if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_RX_QUEUE) != 0
+                    RPDO->rxQueueTail = RPDO->rxQueueHead;
 #endif
                     if (ret != CO_ERROR_NO) {
                         return ODR_DEV_INCOMPAT;
@@ -587,6 +1074,9 @@ OD_write_14xx(OD_stream_t* stream, const void* buf, OD_size_t count, OD_size_t*
             /* Remove old frame from the second buffer. */
             if (RPDO->synchronous != synchronous) {
                 CO_FLAG_CLEAR(RPDO->CANrxNew[1]);
+#if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_RX_QUEUE) != 0
+                RPDO->rxQueueTail = RPDO->rxQueueHead;
+#endif
             }
 
             RPDO->synchronous = synchronous;
@@ -620,6 +1110,9 @@ CO_ReturnError_t
 CO_RPDO_init(CO_RPDO_t* RPDO, OD_t* OD, CO_EM_t* em,
 #if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_SYNC_ENABLE) != 0
              CO_SYNC_t* SYNC,
+#endif
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_COLD_SPLIT) != 0
+             CO_PDO_cold_t* cold,
 #endif
              uint16_t preDefinedCanId, OD_entry_t* OD_14xx_RPDOCommPar, OD_entry_t* OD_16xx_RPDOMapPar,
              CO_CANmodule_t* CANdevRx, uint16_t CANdevRxIdx, uint32_t* errInfo) {
@@ -632,9 +1125,18 @@ CO_RPDO_init(CO_RPDO_t* RPDO, OD_t* OD, CO_EM_t* em,
         || (CANdevRx == NULL)) {
         return CO_ERROR_ILLEGAL_ARGUMENT;
     }
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_COLD_SPLIT) != 0
+    if (cold == NULL) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
+#endif
 
     /* clear object */
     (void)memset(RPDO, 0, sizeof(CO_RPDO_t));
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_COLD_SPLIT) != 0
+    (void)memset(cold, 0, sizeof(CO_PDO_cold_t));
+    PDO->cold = cold;
+#endif
 
     /* Configure object variables */
     PDO->em = em;
@@ -659,7 +1161,7 @@ CO_RPDO_init(CO_RPDO_t* RPDO, OD_t* OD, CO_EM_t* em,
 
     bool_t valid = (COB_ID & 0x80000000U) == 0U;
     uint16_t CAN_ID = (uint16_t)(COB_ID & 0x7FFU);
-    if (valid && ((PDO->mappedObjectsCount == 0U) || (CAN_ID == 0U))) {
+    if (valid && ((PDO->dataLength == 0U) || (CAN_ID == 0U))) {
         valid = false;
         if (erroneousMap == 0U) {
             erroneousMap = 1;
@@ -710,19 +1212,23 @@ CO_RPDO_init(CO_RPDO_t* RPDO, OD_t* OD, CO_EM_t* em,
 
     /* Configure OD extensions */
 #if ((CO_CONFIG_PDO)&CO_CONFIG_FLAG_OD_DYNAMIC) != 0
-    PDO->isRPDO = true;
-    PDO->OD = OD;
-    PDO->CANdevIdx = CANdevRxIdx;
-    PDO->preDefinedCanId = preDefinedCanId;
-    PDO->configuredCanId = CAN_ID;
-    PDO->OD_communicationParam_ext.object = RPDO;
-    PDO->OD_communicationParam_ext.read = OD_read_PDO_commParam;
-    PDO->OD_communicationParam_ext.write = OD_write_14xx;
-    PDO->OD_mappingParam_extension.object = RPDO;
-    PDO->OD_mappingParam_extension.read = OD_readOriginal;
-    PDO->OD_mappingParam_extension.write = OD_write_PDO_mapping;
-    (void)OD_extension_init(OD_14xx_RPDOCommPar, &PDO->OD_communicationParam_ext);
-    (void)OD_extension_init(OD_16xx_RPDOMapPar, &PDO->OD_mappingParam_extension);
+    CO_PDO_COLD(PDO)->isRPDO = true;
+    CO_PDO_COLD(PDO)->OD = OD;
+    CO_PDO_COLD(PDO)->CANdevIdx = CANdevRxIdx;
+    CO_PDO_COLD(PDO)->preDefinedCanId = preDefinedCanId;
+    CO_PDO_COLD(PDO)->configuredCanId = CAN_ID;
+    CO_PDO_COLD(PDO)->OD_communicationParam_ext.object = RPDO;
+    CO_PDO_COLD(PDO)->OD_communicationParam_ext.read = OD_read_PDO_commParam;
+    CO_PDO_COLD(PDO)->OD_communicationParam_ext.write = OD_write_14xx;
+    CO_PDO_COLD(PDO)->OD_mappingParam_extension.object = RPDO;
+    CO_PDO_COLD(PDO)->OD_mappingParam_extension.read = OD_readOriginal;
+    CO_PDO_COLD(PDO)->OD_mappingParam_extension.write = OD_write_PDO_mapping;
+    (void)OD_extension_init(OD_14xx_RPDOCommPar, &CO_PDO_COLD(PDO)->OD_communicationParam_ext);
+    (void)OD_extension_init(OD_16xx_RPDOMapPar, &CO_PDO_COLD(PDO)->OD_mappingParam_extension);
+#endif
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_STAGED_MAPPING) != 0
+    CO_PDO_COLD(PDO)->OD_communicationParam = OD_14xx_RPDOCommPar;
+    CO_PDO_COLD(PDO)->OD_mappingParam = OD_16xx_RPDOMapPar;
 #endif
 
     return CO_ERROR_NO;
@@ -738,152 +1244,580 @@ CO_RPDO_initCallbackPre(CO_RPDO_t* RPDO, void* object, void (*pFunctSignalPre)(v
 }
 #endif
 
-void
-CO_RPDO_process(CO_RPDO_t* RPDO,
-#if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_TIMERS_ENABLE) != 0
-                uint32_t timeDifference_us, bool_t* timeoutState, uint32_t* timerNext_us,
-#endif
-                bool_t NMTisOperational, bool_t syncWas) {
-    (void)syncWas;
-#if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_TIMERS_ENABLE) != 0
-    (void)timerNext_us;
-#endif
+#if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_RX_QUEUE) != 0
+CO_ReturnError_t
+CO_RPDO_initRxQueue(CO_RPDO_t* RPDO, uint8_t (*queue)[CO_PDO_MAX_SIZE], uint16_t queueSize,
+                    CO_RPDO_rxQueueMode_t mode) {
+    if ((RPDO == NULL) || ((queue != NULL) && (queueSize < 2U))) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
 
-    CO_PDO_common_t* PDO = &RPDO->PDO_common;
+    /* disable the queue first, so CO_PDO_receive() does not use it during configuration */
+    RPDO->rxQueue = NULL;
+    RPDO->rxQueueSize = queueSize;
+    RPDO->rxQueueHead = 0;
+    RPDO->rxQueueTail = 0;
+    RPDO->rxQueueMode = (uint8_t)mode;
+    RPDO->rxOverrun = 0;
+    RPDO->rxQueue = queue;
 
-    if (PDO->valid && NMTisOperational
-#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_SYNC_ENABLE) != 0
-        && (syncWas || !RPDO->synchronous)
+    return CO_ERROR_NO;
+}
 #endif
-    ) {
-        /* Verify errors in length of received RPDO message */
-        if (RPDO->receiveError > CO_RPDO_RX_ACK) {
-            bool_t setError = RPDO->receiveError != CO_RPDO_RX_OK;
-            uint16_t code = (RPDO->receiveError == CO_RPDO_RX_SHORT) ? CO_EMC_PDO_LENGTH : CO_EMC_PDO_LENGTH_EXC;
-            CO_error(PDO->em, setError, CO_EM_RPDO_WRONG_LENGTH, code, PDO->dataLength);
-            RPDO->receiveError = setError ? CO_RPDO_RX_ACK_ERROR : CO_RPDO_RX_ACK_NO_ERROR;
+
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_MPDO) != 0
+/*
+ * Find slot in MPDO dispatcher hash table
+ *
+ * Open addressing with linear probing is used. Hash table has always at least one empty slot.
+ *
+ * @param dispatcher MPDO dispatcher.
+ * @param key Producer node-ID, index and sub-index.
+ *
+ * @return Slot with matching key or empty slot, where key can be inserted.
+ */
+static CO_MPDO_dispatchSlot_t*
+CO_MPDO_findSlot(const CO_MPDO_dispatcher_t* dispatcher, uint32_t key) {
+    uint16_t mask = dispatcher->slotsCount - 1U;
+    uint16_t i = (uint16_t)((uint32_t)(key * 0x9E3779B1U) >> (32U - dispatcher->slotsBits));
+
+    while ((dispatcher->slots[i].key != key) && (dispatcher->slots[i].key != 0U)) {
+        i = (i + 1U) & mask;
+    }
+    return &dispatcher->slots[i];
+}
+
+CO_ReturnError_t
+CO_MPDO_dispatcher_init(CO_MPDO_dispatcher_t* dispatcher, OD_t* OD, CO_MPDO_dispatchSlot_t* slots,
+                        uint16_t slotsCount, uint32_t* errInfo) {
+    /* verify arguments */
+    if ((dispatcher == NULL) || (OD == NULL) || (slots == NULL) || (slotsCount < 2U)
+        || ((slotsCount & (slotsCount - 1U)) != 0U)) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
+
+    dispatcher->slots = slots;
+    dispatcher->slotsCount = slotsCount;
+    dispatcher->slotsUsed = 0;
+    dispatcher->slotsBits = 0;
+    while ((1U << dispatcher->slotsBits) < slotsCount) {
+        dispatcher->slotsBits++;
+    }
+    (void)memset(slots, 0, sizeof(CO_MPDO_dispatchSlot_t) * slotsCount);
+
+    /* insert objects from all object dispatching lists */
+    for (uint16_t index = 0x1FD0U; index <= 0x1FFFU; index++) {
+        OD_entry_t* list = OD_find(OD, index);
+        uint8_t count = 0;
+        if ((list == NULL) || (OD_get_u8(list, 0, &count, true) != ODR_OK)) {
+            continue;
         }
 
-        /* Determine, which of the two rx buffers contains relevant data. */
-        uint8_t bufNo = 0;
-#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_SYNC_ENABLE) != 0
-        if (RPDO->synchronous && (RPDO->SYNC != NULL) && !RPDO->SYNC->CANrxToggle) {
-            bufNo = 1;
+        for (uint16_t sub = 1; sub <= count; sub++) {
+            uint64_t val = 0;
+            if ((OD_get_u64(list, (uint8_t)sub, &val, true) != ODR_OK) || (val == 0U)) {
+                continue;
+            }
+            uint8_t blockSize = (uint8_t)(val >> 56);
+            uint16_t localIndex = (uint16_t)(val >> 40);
+            uint8_t localSubIndex = (uint8_t)(val >> 32);
+            uint32_t key = (uint32_t)((val & 0xFFU) << 24) | (uint32_t)((val >> 8) & 0xFFFFFFU);
+            OD_entry_t* entry = OD_find(OD, localIndex);
+
+            if (entry == NULL) {
+                if (errInfo != NULL) {
+                    *errInfo = ((uint32_t)index << 8) | sub;
+                }
+                return CO_ERROR_OD_PARAMETERS;
+            }
+            if (blockSize == 0U) {
+                blockSize = 1;
+            }
+
+            /* insert each object of the block, sub-indexes must not overflow */
+            for (uint16_t j = 0; (j < blockSize) && (((key & 0xFFU) + j) <= 0xFFU)
+                                 && (((uint16_t)localSubIndex + j) <= 0xFFU);
+                 j++) {
+                CO_MPDO_dispatchSlot_t* slot = CO_MPDO_findSlot(dispatcher, key + j);
+                if (slot->key == 0U) {
+                    if ((dispatcher->slotsUsed + 1U) >= slotsCount) {
+                        if (errInfo != NULL) {
+                            *errInfo = ((uint32_t)index << 8) | sub;
+                        }
+                        return CO_ERROR_OUT_OF_MEMORY;
+                    }
+                    dispatcher->slotsUsed++;
+                }
+                slot->key = key + j;
+                slot->entry = entry;
+                slot->subIndex = (uint8_t)(localSubIndex + j);
+            }
+        }
+    }
+
+    return CO_ERROR_NO;
+}
+
+void
+CO_RPDO_initMPDO(CO_RPDO_t* RPDO, OD_t* OD, uint8_t nodeId, const CO_MPDO_dispatcher_t* dispatcher) {
+    if (RPDO != NULL) {
+        RPDO->mpdoOD = OD;
+        RPDO->mpdoNodeId = nodeId;
+        RPDO->mpdoDispatcher = dispatcher;
+    }
+}
+
+/*
+ * Process received MPDO
+ *
+ * Write data from MPDO into OD variable. Variable is specified by multiplexer directly (DAM) or is found by MPDO
+ * dispatcher (SAM). MPDOs, which are not addressed to this node or are not in the object dispatching list, are ignored.
+ * If destination variable is not accessible, CO_EM_PDO_WRONG_MAPPING is reported once and is reset by the next MPDO,
+ * which is written successfully.
+ *
+ * @param RPDO RPDO object.
+ * @param data Data of the received MPDO, 8 bytes.
+ */
+static void
+CO_RPDO_processMPDO(CO_RPDO_t* RPDO, const uint8_t* data) {
+    CO_PDO_common_t* PDO = &RPDO->PDO_common;
+    uint8_t address = data[0];
+    uint16_t index = (uint16_t)data[1] | ((uint16_t)data[2] << 8);
+    uint8_t subIndex = data[3];
+    OD_entry_t* entry = NULL;
+    OD_IO_t OD_IO;
+
+    if (PDO->mpdoMode == (uint8_t)CO_PDO_MPDO_DAM) {
+        uint8_t nodeId = address & 0x7FU;
+        if (((address & 0x80U) == 0U) || (RPDO->mpdoOD == NULL) || ((nodeId != 0U) && (nodeId != RPDO->mpdoNodeId))) {
+            return;
+        }
+        entry = OD_find(RPDO->mpdoOD, index);
+    } else {
+        if (((address & 0x80U) != 0U) || (RPDO->mpdoDispatcher == NULL)) {
+            return;
+        }
+        uint32_t key = ((uint32_t)address << 24) | ((uint32_t)index << 8) | subIndex;
+        const CO_MPDO_dispatchSlot_t* slot = CO_MPDO_findSlot(RPDO->mpdoDispatcher, key);
+        if (slot->key == 0U) {
+            return;
+        }
+        entry = slot->entry;
+        subIndex = slot->subIndex;
+    }
+
+    if ((OD_getSub(entry, subIndex, &OD_IO, false) != ODR_OK) || ((OD_IO.stream.attribute & ODA_RPDO) == 0U)
+        || (OD_IO.stream.dataLength == 0U) || (OD_IO.stream.dataLength > 4U)) {
+        if (!RPDO->mpdoError) {
+            /* CiA 301 specifies emergency code for DAM only */
+            uint16_t code = (PDO->mpdoMode == (uint8_t)CO_PDO_MPDO_DAM) ? CO_EMC_DAM_MPDO : CO_EMC_PROTOCOL_ERROR;
+            CO_errorReport(PDO->em, CO_EM_PDO_WRONG_MAPPING, code, ((uint32_t)index << 8) | data[3]);
+            RPDO->mpdoError = true;
+        }
+        return;
+    }
+
+    uint8_t buf[4];
+    (void)memcpy(buf, &data[4], OD_IO.stream.dataLength);
+#ifdef CO_BIG_ENDIAN
+    if ((OD_IO.stream.attribute & ODA_MB) != 0U) {
+        PDO_swapMPDO(buf, OD_IO.stream.dataLength);
+    }
+#endif
+    OD_size_t countWritten;
+    (void)OD_IO.write(&OD_IO.stream, buf, OD_IO.stream.dataLength, &countWritten);
+
+    if (RPDO->mpdoError) {
+        CO_errorReset(PDO->em, CO_EM_PDO_WRONG_MAPPING, ((uint32_t)index << 8) | data[3]);
+        RPDO->mpdoError = false;
+    }
+}
+#endif /* (CO_CONFIG_PDO) & CO_CONFIG_PDO_MPDO */
+
+#if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_COPY_PLAN) != 0) && (((CO_CONFIG_PDO)&CO_CONFIG_PDO_BITWISE_MAPPING) == 0)
+/*
+ * Write one mapped entry from RPDO data into OD variable with OD_IO write() function.
+ *
+ * Used by copy plan for entries, which can not be copied directly. If mappedLength is smaller than length of OD
+ * variable, remaining bytes are zero.
+ *
+ * @param OD_IO Object dictionary interface of the mapped entry.
+ * @param dataRPDO Pointer to data of the entry inside RPDO.
+ */
+static void
+PDO_writeEntry(OD_IO_t* OD_IO, const uint8_t* dataRPDO) {
+    OD_size_t* dataOffset = &OD_IO->stream.dataOffset;
+    uint8_t mappedLength = (uint8_t)(*dataOffset);
+    OD_size_t ODdataLength = OD_IO->stream.dataLength;
+    if (ODdataLength > CO_PDO_MAX_SIZE) {
+        ODdataLength = CO_PDO_MAX_SIZE;
+    }
+
+    uint8_t buf[CO_PDO_MAX_SIZE];
+    (void)memset(buf, 0, sizeof(buf));
+    (void)memcpy(buf, dataRPDO, mappedLength);
+
+    /* swap multibyte data if big-endian */
+#ifdef CO_BIG_ENDIAN
+    if ((OD_IO->stream.attribute & ODA_MB) != 0) {
+        uint8_t* lo = buf;
+        uint8_t* hi = buf + ODdataLength - 1;
+        while (lo < hi) {
+            uint8_t swap = *lo;
+            *lo++ = *hi;
+            *hi-- = swap;
         }
+    }
 #endif
 
-        /* copy RPDO into OD variables according to mappings */
-        bool_t rpdoReceived = false;
-        while (CO_FLAG_READ(RPDO->CANrxNew[bufNo])) {
-            rpdoReceived = true;
-            uint8_t* dataRPDO = RPDO->CANrxData[bufNo];
-            OD_size_t verifyLength = 0U;
+    /* Set stream.dataOffset to zero, perform OD_IO.write() and store mappedLength back to stream.dataOffset */
+    *dataOffset = 0;
+    OD_size_t countWritten;
+    (void)OD_IO->write(&OD_IO->stream, buf, ODdataLength, &countWritten);
+    *dataOffset = mappedLength;
+}
+#endif /* (CO_CONFIG_PDO) & CO_CONFIG_PDO_COPY_PLAN */
+
+/*
+ * Copy data from received RPDO CAN frame into mapped OD variables.
+ *
+ * Called, if RPDO is valid and in NMT operational state. Synchronous RPDO is called only after SYNC.
+ *
+ * @param RPDO This object.
+ *
+ * @return True, if new RPDO CAN frame was received.
+ */
+static bool_t
+CO_RPDO_copyData(CO_RPDO_t* RPDO) {
+    CO_PDO_common_t* PDO = &RPDO->PDO_common;
 
-            /* Clear the flag. If between the copy operation CANrxNew is set
-             * by receive thread, then copy the latest data again. */
-            CO_FLAG_CLEAR(RPDO->CANrxNew[bufNo]);
+    /* Verify errors in length of received RPDO message */
+    if (RPDO->receiveError > CO_RPDO_RX_ACK) {
+        bool_t setError = RPDO->receiveError != CO_RPDO_RX_OK;
+        uint16_t code = (RPDO->receiveError == CO_RPDO_RX_SHORT) ? CO_EMC_PDO_LENGTH : CO_EMC_PDO_LENGTH_EXC;
+        CO_error(PDO->em, setError, CO_EM_RPDO_WRONG_LENGTH, code, PDO->dataLength);
+        RPDO->receiveError = setError ? CO_RPDO_RX_ACK_ERROR : CO_RPDO_RX_ACK_NO_ERROR;
+    }
+
+    /* Determine, which of the two rx buffers contains relevant data. */
+    uint8_t bufNo = 0;
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_SYNC_ENABLE) != 0
+    if (RPDO->synchronous && (RPDO->SYNC != NULL) && !RPDO->SYNC->CANrxToggle) {
+        bufNo = 1;
+    }
+#endif
+
+    /* copy RPDO into OD variables according to mappings */
+    bool_t rpdoReceived = false;
+#if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_RX_QUEUE) != 0
+    bool_t rxQueueUsed = CO_RPDO_rxQueueUsed(RPDO);
+    while (CO_FLAG_READ(RPDO->CANrxNew[bufNo]) || (rxQueueUsed && (RPDO->rxQueueHead != RPDO->rxQueueTail))) {
+#else
+    while (CO_FLAG_READ(RPDO->CANrxNew[bufNo])) {
+#endif
+        uint8_t* dataRPDO = RPDO->CANrxData[bufNo];
+        OD_size_t verifyLength = 0U;
+
+        /* Clear the flag. If between the copy operation CANrxNew is set
+         * by receive thread, then copy the latest data again. */
+        CO_FLAG_CLEAR(RPDO->CANrxNew[bufNo]);
+
+#if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_RX_QUEUE) != 0
+        /* Take RPDO from the queue. Head is read after CO_FLAG_CLEAR, which also acts as memory barrier. */
+        uint8_t dataQueue[CO_PDO_MAX_SIZE];
+        if (rxQueueUsed) {
+            uint16_t head = RPDO->rxQueueHead;
+            uint16_t tail = RPDO->rxQueueTail;
+            if (head == tail) {
+                continue;
+            }
+            if (RPDO->rxQueueMode == (uint8_t)CO_RPDO_RXQ_LATEST) {
+                tail = (head > 0U) ? (head - 1U) : (RPDO->rxQueueSize - 1U);
+            }
+            (void)memcpy(dataQueue, RPDO->rxQueue[tail], CO_PDO_MAX_SIZE);
+            RPDO->rxQueueTail = ((tail + 1U) < RPDO->rxQueueSize) ? (tail + 1U) : 0U;
+            dataRPDO = dataQueue;
+        }
+#endif
+        rpdoReceived = true;
+
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_MPDO) != 0
+        if (PDO->mpdoMode != 0U) {
+            uint8_t dataMPDO[8];
+            (void)memcpy(dataMPDO, dataRPDO, sizeof(dataMPDO));
+            CO_RPDO_processMPDO(RPDO, dataMPDO);
+            continue;
+        }
+#endif
 
 #if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_BITWISE_MAPPING) != 0
-            /* Copy everything regardless of the actual PDO size to UINT64 to simplify bit shifting */
-            uint64_t buf64 = 0;
-            (void)memcpy(&buf64, dataRPDO, CO_PDO_MAX_SIZE);
+        /* Copy everything regardless of the actual PDO size to UINT64 to simplify bit shifting */
+        uint64_t buf64 = 0;
+        (void)memcpy(&buf64, dataRPDO, CO_PDO_MAX_SIZE);
 #ifdef CO_BIG_ENDIAN
-            /* For big endian we need to swap all bytes */
-            buf64 = CO_SWAP_64(buf64);
+        /* For big endian we need to swap all bytes */
+        buf64 = CO_SWAP_64(buf64);
 #endif /* CO_BIG_ENDIAN */
 #endif /* ((CO_CONFIG_PDO)&CO_CONFIG_PDO_BITWISE_MAPPING) */
-#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_OD_IO_ACCESS) != 0
-            for (uint8_t i = 0; i < PDO->mappedObjectsCount; i++) {
-                OD_IO_t* OD_IO = &PDO->OD_IO[i];
+#if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_COPY_PLAN) != 0) && (((CO_CONFIG_PDO)&CO_CONFIG_PDO_BITWISE_MAPPING) != 0)
+        for (uint8_t i = 0; i < PDO->copyRunsCount; i++) {
+            const CO_PDO_copyRun_t* run = &PDO->copyRun[i];
+
+            /* additional safety check. */
+            verifyLength += (OD_size_t)run->bits;
+            if (verifyLength > (CO_PDO_MAX_SIZE * 8U)) {
+                break;
+            }
+
+            /* unpack mapped bits into value of OD variable */
+            uint64_t value = (buf64 >> run->shift) & run->mask;
+            uint8_t* dataOD = (uint8_t*)&value + run->valueOffset;
+
+            if (run->dataOD != NULL) {
+                (void)memcpy(run->dataOD, dataOD, run->length);
+            } else {
+                OD_IO_t* OD_IO = &CO_PDO_COLD(PDO)->OD_IO[run->mapIndex];
+                OD_size_t countWritten;
+                OD_IO->stream.dataOffset = 0;
+                (void)OD_IO->write(&OD_IO->stream, dataOD, run->length, &countWritten);
+                OD_IO->stream.dataOffset = run->bits;
+            }
+        }
 
-                /* get mappedLength from temporary storage */
-                OD_size_t* dataOffset = &OD_IO->stream.dataOffset;
-                uint8_t mappedLength = (uint8_t)(*dataOffset);
+#elif ((CO_CONFIG_PDO)&CO_CONFIG_PDO_COPY_PLAN) != 0
+        for (uint8_t i = 0; i < PDO->copyRunsCount; i++) {
+            const CO_PDO_copyRun_t* run = &PDO->copyRun[i];
 
-                /* additional safety check. */
-                verifyLength += (OD_size_t)mappedLength;
+            /* additional safety check. */
+            verifyLength += (OD_size_t)run->length;
+            if (verifyLength > CO_PDO_MAX_SIZE) {
+                break;
+            }
+
+            if (run->dataOD == NULL) {
+                PDO_writeEntry(&CO_PDO_COLD(PDO)->OD_IO[run->mapIndex], &dataRPDO[run->offset]);
+            }
+#ifdef CO_BIG_ENDIAN
+            else if (run->swap) {
+                PDO_copySwap(run->dataOD, &dataRPDO[run->offset], run->length);
+            }
+#endif
+            else {
+                (void)memcpy(run->dataOD, &dataRPDO[run->offset], run->length);
+            }
+        }
+
+#elif ((CO_CONFIG_PDO)&CO_CONFIG_PDO_OD_IO_ACCESS) != 0
+        for (uint8_t i = 0; i < PDO->mappedObjectsCount; i++) {
+            OD_IO_t* OD_IO = &CO_PDO_COLD(PDO)->OD_IO[i];
+
+            /* get mappedLength from temporary storage */
+            OD_size_t* dataOffset = &OD_IO->stream.dataOffset;
+            uint8_t mappedLength = (uint8_t)(*dataOffset);
+
+            /* additional safety check. */
+            verifyLength += (OD_size_t)mappedLength;
 #if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_BITWISE_MAPPING) != 0
-                if (verifyLength > CO_PDO_MAX_SIZE * 8) {
+            if (verifyLength > CO_PDO_MAX_SIZE * 8) {
 #else
-                if (verifyLength > CO_PDO_MAX_SIZE) {
+            if (verifyLength > CO_PDO_MAX_SIZE) {
 #endif
-                    break;
-                }
+                break;
+            }
 
-                /* length of OD variable may be larger than mappedLength */
-                OD_size_t ODdataLength = OD_IO->stream.dataLength;
-                if (ODdataLength > CO_PDO_MAX_SIZE) {
-                    ODdataLength = CO_PDO_MAX_SIZE;
-                }
+            /* length of OD variable may be larger than mappedLength */
+            OD_size_t ODdataLength = OD_IO->stream.dataLength;
+            if (ODdataLength > CO_PDO_MAX_SIZE) {
+                ODdataLength = CO_PDO_MAX_SIZE;
+            }
 #if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_BITWISE_MAPPING) != 0
-                /* Prepare data for writing into OD variable. If mappedLength
-                 * is smaller than ODdataLength, then use auxiliary buffer */
-                uint8_t* dataOD;
-                /* Apply the bitmask */
-                uint64_t shiftedData = buf64 & (UINT64_MAX >> (64 - mappedLength));
-                /* Shift the original buffer to get ready for the next mapping */
-                buf64 >>= mappedLength;
+            /* Prepare data for writing into OD variable. If mappedLength
+             * is smaller than ODdataLength, then use auxiliary buffer */
+            uint8_t* dataOD;
+            /* Apply the bitmask */
+            uint64_t shiftedData = buf64 & (UINT64_MAX >> (64 - mappedLength));
+            /* Shift the original buffer to get ready for the next mapping */
+            buf64 >>= mappedLength;
 #ifdef CO_BIG_ENDIAN
-                /* Adjust the pointer ignoring unused most significant bytes */
-                dataOD = (uint8_t *)&shiftedData + 8 - ODdataLength;
+            /* Adjust the pointer ignoring unused most significant bytes */
+            dataOD = (uint8_t *)&shiftedData + 8 - ODdataLength;
 #else
-                /* For little-endian we have a pointer to LSB */
-                dataOD = (uint8_t *)&shiftedData;
+            /* For little-endian we have a pointer to LSB */
+            dataOD = (uint8_t *)&shiftedData;
 #endif
 #else
-                /* Prepare data for writing into OD variable. If mappedLength
-                 * is smaller than ODdataLength, then use auxiliary buffer */
-                uint8_t buf[CO_PDO_MAX_SIZE];
-                uint8_t* dataOD;
-                if (ODdataLength > mappedLength) {
-                    (void)memset(buf, 0, sizeof(buf));
-                    (void)memcpy(buf, dataRPDO, mappedLength);
-                    dataOD = buf;
-                } else {
-                    dataOD = dataRPDO;
-                }
+            /* Prepare data for writing into OD variable. If mappedLength
+             * is smaller than ODdataLength, then use auxiliary buffer */
+            uint8_t buf[CO_PDO_MAX_SIZE];
+            uint8_t* dataOD;
+            if (ODdataLength > mappedLength) {
+                (void)memset(buf, 0, sizeof(buf));
+                (void)memcpy(buf, dataRPDO, mappedLength);
+                dataOD = buf;
+            } else {
+                dataOD = dataRPDO;
+            }
 
-                /* swap multibyte data if big-endian */
+            /* swap multibyte data if big-endian */
 #ifdef CO_BIG_ENDIAN
-                if ((OD_IO->stream.attribute & ODA_MB) != 0) {
-                    uint8_t* lo = dataOD;
-                    uint8_t* hi = dataOD + ODdataLength - 1;
-                    while (lo < hi) {
-                        uint8_t swap = *lo;
-                        *lo++ = *hi;
-                        *hi-- = swap;
-                    }
+            if ((OD_IO->stream.attribute & ODA_MB) != 0) {
+                uint8_t* lo = dataOD;
+                uint8_t* hi = dataOD + ODdataLength - 1;
+                while (lo < hi) {
+                    uint8_t swap = *lo;
+                    *lo++ = *hi;
+                    *hi-- = swap;
                 }
+            }
 #endif
 #endif /* (CO_CONFIG_PDO)&CO_CONFIG_PDO_BITWISE_MAPPING */
 
-                /* Set stream.dataOffset to zero, perform OD_IO.write()
-                 * and store mappedLength back to stream.dataOffset */
-                *dataOffset = 0;
-                OD_size_t countWritten;
-                OD_IO->write(&OD_IO->stream, dataOD, ODdataLength, &countWritten);
-                *dataOffset = mappedLength;
+            /* Set stream.dataOffset to zero, perform OD_IO.write()
+             * and store mappedLength back to stream.dataOffset */
+            *dataOffset = 0;
+            OD_size_t countWritten;
+            OD_IO->write(&OD_IO->stream, dataOD, ODdataLength, &countWritten);
+            *dataOffset = mappedLength;
+
+            dataRPDO += mappedLength;
+        }
+
+#elif ((CO_CONFIG_PDO)&CO_CONFIG_PDO_BITWISE_MAPPING) != 0
+        for (uint8_t i = 0; i < PDO->mappedObjectsCount; i++) {
+            const CO_PDO_directMap_t* directMap = &PDO->directMap[i];
+            uint8_t shift = (uint8_t)verifyLength;
 
-                dataRPDO += mappedLength;
+            /* additional safety check. */
+            verifyLength += (OD_size_t)directMap->bits;
+            if (verifyLength > (CO_PDO_MAX_SIZE * 8U)) {
+                break;
             }
 
+            /* unpack mapped bits into value of OD variable */
+            uint64_t value = 0;
+            if (directMap->bits > 0U) {
+                value = (buf64 >> shift) & (UINT64_MAX >> (64U - directMap->bits));
+            }
+            (void)memcpy(PDO->directDataOD[i], (uint8_t*)&value + CO_PDO_VALUE_OFFSET(directMap->length),
+                         directMap->length);
+        }
+
 #else
-            verifyLength = (OD_size_t)PDO->dataLength;
-            for (uint8_t i = 0; i < PDO->dataLength; i++) {
-                *PDO->mapPointer[i] = dataRPDO[i];
+        for (uint8_t i = 0; i < PDO->mappedObjectsCount; i++) {
+            const CO_PDO_directMap_t* directMap = &PDO->directMap[i];
+
+            /* additional safety check. */
+            verifyLength += (OD_size_t)directMap->length;
+            if (verifyLength > CO_PDO_MAX_SIZE) {
+                break;
             }
+
+#ifdef CO_BIG_ENDIAN
+            if (directMap->swap != 0U) {
+                PDO_copySwap(PDO->directDataOD[i], dataRPDO, directMap->length);
+            } else
+#endif
+            {
+                (void)memcpy(PDO->directDataOD[i], dataRPDO, directMap->length);
+            }
+            dataRPDO += directMap->length;
+        }
 #endif /* (CO_CONFIG_PDO) & CO_CONFIG_PDO_OD_IO_ACCESS */
 
 #if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_BITWISE_MAPPING) != 0
-            if ((verifyLength > (CO_PDO_MAX_SIZE * 8)) || (verifyLength != (OD_size_t)PDO->dataLength)) {
+        if ((verifyLength > (CO_PDO_MAX_SIZE * 8)) || (verifyLength != (OD_size_t)PDO->dataLength)) {
 #else
-            if ((verifyLength > CO_PDO_MAX_SIZE) || (verifyLength != (OD_size_t)PDO->dataLength)) {
+        if ((verifyLength > CO_PDO_MAX_SIZE) || (verifyLength != (OD_size_t)PDO->dataLength)) {
+#endif
+            /* bug in software, should not happen */
+            CO_errorReport(PDO->em, CO_EM_GENERIC_SOFTWARE_ERROR, CO_EMC_SOFTWARE_INTERNAL,
+                           (0x100000U | verifyLength));
+        }
+    } /* while (CO_FLAG_READ(RPDO->CANrxNew[bufNo])) */
+
+    return rpdoReceived;
+}
+
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_STAGED_MAPPING) != 0
+ODR_t
+CO_RPDO_stageMapping(CO_RPDO_t* RPDO, CO_PDO_stagedMap_t* stagedMap, const uint32_t* map,
+                     uint8_t mappedObjectsCount, uint16_t CAN_ID) {
+    if ((RPDO == NULL) || (stagedMap == NULL) || (map == NULL)) {
+        return ODR_DEV_INCOMPAT;
+    }
+    if (RPDO->stagedMap != NULL) {
+        return ODR_DATA_DEV_STATE;
+    }
+
+    ODR_t odRet = PDO_stageMapping(&RPDO->PDO_common, stagedMap, map, mappedObjectsCount, CAN_ID);
+    if (odRet == ODR_OK) {
+        RPDO->stagedMap = stagedMap;
+#if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_READY_LIST) != 0
+        if (RPDO->readyList != NULL) {
+            RPDO->readyList->stagedPending = true;
+        }
+#endif
+    }
+    return odRet;
+}
+
+/*
+ * Swap staged mapping into RPDO, if it is staged and allowed.
+ *
+ * Synchronous RPDO swaps only after SYNC, after its data was written to OD variables.
+ *
+ * @return True, if staged mapping is still pending.
+ */
+static bool_t
+CO_RPDO_processStaged(CO_RPDO_t* RPDO, bool_t NMTisOperational, bool_t syncWas) {
+    CO_PDO_common_t* PDO = &RPDO->PDO_common;
+    CO_PDO_stagedMap_t* stagedMap = RPDO->stagedMap;
+
+    if (stagedMap == NULL) {
+        return false;
+    }
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_SYNC_ENABLE) != 0
+    if (PDO->valid && NMTisOperational && RPDO->synchronous && !syncWas) {
+        return true;
+    }
+#else
+    (void)NMTisOperational;
+    (void)syncWas;
 #endif
-                /* bug in software, should not happen */
-                CO_errorReport(PDO->em, CO_EM_GENERIC_SOFTWARE_ERROR, CO_EMC_SOFTWARE_INTERNAL,
-                               (0x100000U | verifyLength));
-            }
-        } /* while (CO_FLAG_READ(RPDO->CANrxNew[bufNo])) */
+
+    RPDO->stagedMap = NULL;
+    if (PDO_swapMapping(PDO, stagedMap) && PDO->valid) {
+        CO_ReturnError_t ret = CO_CANrxBufferInit(PDO->CANdev, CO_PDO_COLD(PDO)->CANdevIdx, stagedMap->CAN_ID, 0x7FF,
+                                                  false, (void*)RPDO, CO_PDO_receive);
+        if (ret == CO_ERROR_NO) {
+            CO_PDO_COLD(PDO)->configuredCanId = stagedMap->CAN_ID;
+        } else {
+            PDO->valid = false;
+        }
+    }
+    return false;
+}
+#endif /* (CO_CONFIG_PDO) & CO_CONFIG_PDO_STAGED_MAPPING */
+
+void
+CO_RPDO_process(CO_RPDO_t* RPDO,
+#if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_TIMERS_ENABLE) != 0
+                uint32_t timeDifference_us, bool_t* timeoutState, uint32_t* timerNext_us,
+#endif
+                bool_t NMTisOperational, bool_t syncWas) {
+    (void)syncWas;
+#if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_TIMERS_ENABLE) != 0
+    (void)timerNext_us;
+#endif
+
+    CO_PDO_common_t* PDO = &RPDO->PDO_common;
+
+    if (PDO->valid && NMTisOperational
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_SYNC_ENABLE) != 0
+        && (syncWas || !RPDO->synchronous)
+#endif
+    ) {
+        bool_t rpdoReceived = CO_RPDO_copyData(RPDO);
 
         /* verify RPDO timeout */
         (void)rpdoReceived;
@@ -922,18 +1856,264 @@ CO_RPDO_process(CO_RPDO_t* RPDO,
         if (!PDO->valid || !NMTisOperational) {
             CO_FLAG_CLEAR(RPDO->CANrxNew[0]);
             CO_FLAG_CLEAR(RPDO->CANrxNew[1]);
+#if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_RX_QUEUE) != 0
+            RPDO->rxQueueTail = RPDO->rxQueueHead;
+#endif
 #if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_TIMERS_ENABLE) != 0
             RPDO->timeoutTimer = 0;
 #endif
         }
 #else
         CO_FLAG_CLEAR(RPDO->CANrxNew[0]);
+#if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_RX_QUEUE) != 0
+        RPDO->rxQueueTail = RPDO->rxQueueHead;
+#endif
 #if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_TIMERS_ENABLE) != 0
         RPDO->timeoutTimer = 0;
 #endif
 #endif
     }
+
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_STAGED_MAPPING) != 0
+    (void)CO_RPDO_processStaged(RPDO, NMTisOperational, syncWas);
+#endif
+}
+
+#if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_READY_LIST) != 0
+CO_ReturnError_t
+CO_RPDO_readyList_init(CO_RPDO_readyList_t* readyList, CO_RPDO_t* RPDOs, uint16_t RPDOcount, uint16_t* queue,
+                       uint16_t* syncPending) {
+    /* verify arguments */
+    if ((readyList == NULL) || (RPDOs == NULL) || (RPDOcount == 0U) || (RPDOcount == 0xFFFFU) || (queue == NULL)
+        || (syncPending == NULL)) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
+
+    (void)memset(readyList, 0, sizeof(CO_RPDO_readyList_t));
+    readyList->queue = queue;
+    readyList->queueSize = RPDOcount + 1U;
+    readyList->syncPending = syncPending;
+
+    for (uint16_t i = 0; i < RPDOcount; i++) {
+        CO_RPDO_t* RPDO = &RPDOs[i];
+        RPDO->readyIndex = i;
+        RPDO->readySyncPending = false;
+        CO_FLAG_CLEAR(RPDO->readyQueued);
+        RPDO->readyList = readyList;
+    }
+
+    return CO_ERROR_NO;
+}
+
+#if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_TIMERS_ENABLE) != 0
+/*
+ * Set earliest deadline of the ready list, if deadline is earlier.
+ */
+static void
+CO_RPDO_armDeadline(CO_RPDO_readyList_t* readyList, uint32_t deadline_us) {
+    if (!readyList->deadlineArmed || ((int32_t)(deadline_us - readyList->nextDeadline_us) < 0)) {
+        readyList->nextDeadline_us = deadline_us;
+        readyList->deadlineArmed = true;
+    }
 }
+
+/*
+ * Stop timeout monitoring of the RPDO.
+ */
+static void
+CO_RPDO_stopTimeout(CO_RPDO_readyList_t* readyList, CO_RPDO_t* RPDO) {
+    if (RPDO->readyTimedOut) {
+        RPDO->readyTimedOut = false;
+        readyList->timedOutCount--;
+    }
+    RPDO->timeoutTimer = 0;
+}
+#endif
+
+/*
+ * Process RPDO from the ready list, same as CO_RPDO_process(), but without timeout timer.
+ *
+ * @return True, if synchronous RPDO has new data and must wait for SYNC.
+ */
+static bool_t
+CO_RPDO_processReady(CO_RPDO_readyList_t* readyList, CO_RPDO_t* RPDO, bool_t NMTisOperational, bool_t syncWas) {
+    (void)readyList;
+    (void)syncWas;
+    CO_PDO_common_t* PDO = &RPDO->PDO_common;
+    bool_t syncWait = false;
+
+    if (PDO->valid && NMTisOperational) {
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_SYNC_ENABLE) != 0
+        if (RPDO->synchronous && !syncWas) {
+            return true;
+        }
+#endif
+        bool_t rpdoReceived = CO_RPDO_copyData(RPDO);
+
+        (void)rpdoReceived;
+#if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_TIMERS_ENABLE) != 0
+        if (rpdoReceived && (RPDO->timeoutTime_us > 0U)) {
+            /* enable monitoring, set new deadline */
+            if (RPDO->readyTimedOut) {
+                RPDO->readyTimedOut = false;
+                readyList->timedOutCount--;
+            }
+            RPDO->timeoutTimer = 1;
+            RPDO->timeoutDeadline_us = readyList->time_us + RPDO->timeoutTime_us;
+            CO_RPDO_armDeadline(readyList, RPDO->timeoutDeadline_us);
+        }
+#endif
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_SYNC_ENABLE) != 0
+        /* CAN frame, received after SYNC, is in the other buffer */
+        if (RPDO->synchronous && (CO_FLAG_READ(RPDO->CANrxNew[0]) || CO_FLAG_READ(RPDO->CANrxNew[1]))) {
+            syncWait = true;
+        }
+#endif
+    } else {
+        CO_FLAG_CLEAR(RPDO->CANrxNew[0]);
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_SYNC_ENABLE) != 0
+        CO_FLAG_CLEAR(RPDO->CANrxNew[1]);
+#endif
+#if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_RX_QUEUE) != 0
+        RPDO->rxQueueTail = RPDO->rxQueueHead;
+#endif
+#if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_TIMERS_ENABLE) != 0
+        CO_RPDO_stopTimeout(readyList, RPDO);
+#endif
+    }
+
+    return syncWait;
+}
+
+void
+CO_RPDO_processReadyList(CO_RPDO_readyList_t* readyList, CO_RPDO_t* RPDOs,
+#if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_TIMERS_ENABLE) != 0
+                         uint32_t timeDifference_us, bool_t* timeoutState, uint32_t* timerNext_us,
+#endif
+                         bool_t NMTisOperational, bool_t syncWas) {
+#if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_TIMERS_ENABLE) != 0
+    (void)timerNext_us;
+#endif
+    if ((readyList == NULL) || (RPDOs == NULL)) {
+        return;
+    }
+
+#if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_TIMERS_ENABLE) != 0
+    uint16_t RPDOcount = readyList->queueSize - 1U;
+    readyList->time_us += timeDifference_us;
+#endif
+
+    /* If NMT operational state was left, clear synchronous RPDOs and stop timeout monitoring of all RPDOs */
+    if (!NMTisOperational && readyList->NMTwasOperational) {
+        for (uint16_t i = 0; i < readyList->syncPendingCount; i++) {
+            CO_RPDO_t* RPDO = &RPDOs[readyList->syncPending[i]];
+            RPDO->readySyncPending = false;
+            (void)CO_RPDO_processReady(readyList, RPDO, NMTisOperational, syncWas);
+        }
+        readyList->syncPendingCount = 0;
+#if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_TIMERS_ENABLE) != 0
+        for (uint16_t i = 0; i < RPDOcount; i++) {
+            CO_RPDO_stopTimeout(readyList, &RPDOs[i]);
+        }
+        readyList->deadlineArmed = false;
+#endif
+    }
+    readyList->NMTwasOperational = NMTisOperational;
+
+    /* Process RPDOs with new data. Read head first, then the queue. */
+    uint16_t head = readyList->head;
+    if (head != readyList->tail) {
+        CO_FLAG_CLEAR(readyList->CANrxNew);
+
+        while (readyList->tail != head) {
+            uint16_t tail = readyList->tail;
+            CO_RPDO_t* RPDO = &RPDOs[readyList->queue[tail]];
+            readyList->tail = ((tail + 1U) < readyList->queueSize) ? (tail + 1U) : 0U;
+
+            /* Clear the flag before processing. If RPDO receives new data meanwhile, it is put into the queue again. */
+            CO_FLAG_CLEAR(RPDO->readyQueued);
+            if (CO_RPDO_processReady(readyList, RPDO, NMTisOperational, syncWas) && !RPDO->readySyncPending) {
+                RPDO->readySyncPending = true;
+                readyList->syncPending[readyList->syncPendingCount] = RPDO->readyIndex;
+                readyList->syncPendingCount++;
+            }
+        }
+    }
+
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_SYNC_ENABLE) != 0
+    /* Process synchronous RPDOs after SYNC, keep those, which received new data after SYNC */
+    if (syncWas && (readyList->syncPendingCount > 0U)) {
+        uint16_t count = readyList->syncPendingCount;
+        readyList->syncPendingCount = 0;
+        for (uint16_t i = 0; i < count; i++) {
+            uint16_t index = readyList->syncPending[i];
+            CO_RPDO_t* RPDO = &RPDOs[index];
+            if (CO_RPDO_processReady(readyList, RPDO, NMTisOperational, syncWas)) {
+                readyList->syncPending[readyList->syncPendingCount] = index;
+                readyList->syncPendingCount++;
+            } else {
+                RPDO->readySyncPending = false;
+            }
+        }
+    }
+#endif
+
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_STAGED_MAPPING) != 0
+    /* Swap staged mappings, after data from SYNC is processed */
+    if (readyList->stagedPending) {
+        bool_t stagedPending = false;
+        for (uint16_t i = 0; i < (readyList->queueSize - 1U); i++) {
+            if (CO_RPDO_processStaged(&RPDOs[i], NMTisOperational, syncWas)) {
+                stagedPending = true;
+            }
+        }
+        readyList->stagedPending = stagedPending;
+    }
+#endif
+
+#if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_TIMERS_ENABLE) != 0
+    /* If earliest deadline expired, verify all monitored RPDOs and find next deadline. RPDO in timeout is verified
+     * again after its event timer. */
+    uint32_t time_us = readyList->time_us;
+    if (readyList->deadlineArmed && ((int32_t)(time_us - readyList->nextDeadline_us) >= 0)) {
+        readyList->deadlineArmed = false;
+        for (uint16_t i = 0; i < RPDOcount; i++) {
+            CO_RPDO_t* RPDO = &RPDOs[i];
+
+            /* timeoutTimer is also cleared by writing RPDO event timer */
+            if ((RPDO->timeoutTimer == 0U) || !RPDO->PDO_common.valid || (RPDO->timeoutTime_us == 0U)) {
+                CO_RPDO_stopTimeout(readyList, RPDO);
+                continue;
+            }
+            if ((int32_t)(time_us - RPDO->timeoutDeadline_us) >= 0) {
+                if (!RPDO->readyTimedOut) {
+                    RPDO->readyTimedOut = true;
+                    readyList->timedOutCount++;
+                    RPDO->timeoutTimer = RPDO->timeoutTime_us + (time_us - RPDO->timeoutDeadline_us) + 1U;
+                    CO_errorReport(RPDO->PDO_common.em, CO_EM_RPDO_TIME_OUT, CO_EMC_RPDO_TIMEOUT,
+                                   RPDO->timeoutTimer);
+                }
+                RPDO->timeoutDeadline_us = time_us + RPDO->timeoutTime_us;
+            }
+            CO_RPDO_armDeadline(readyList, RPDO->timeoutDeadline_us);
+        }
+    }
+
+    if ((timeoutState != NULL) && (readyList->timedOutCount > 0U)) {
+        *timeoutState = true;
+    }
+#if ((CO_CONFIG_PDO)&CO_CONFIG_FLAG_TIMERNEXT) != 0
+    if ((timerNext_us != NULL) && readyList->deadlineArmed) {
+        uint32_t diff = ((int32_t)(readyList->nextDeadline_us - time_us) > 0) ? (readyList->nextDeadline_us - time_us)
+                                                                               : 0U;
+        if (*timerNext_us > diff) {
+            *timerNext_us = diff;
+        }
+    }
+#endif
+#endif /* (CO_CONFIG_PDO) & CO_CONFIG_RPDO_TIMERS_ENABLE */
+}
+#endif /* (CO_CONFIG_PDO) & CO_CONFIG_RPDO_READY_LIST */
 #endif /* (CO_CONFIG_PDO) & CO_CONFIG_RPDO_ENABLE */
 
 /*******************************************************************************
@@ -966,15 +2146,16 @@ OD_write_18xx(OD_stream_t* stream, const void* buf, OD_size_t count, OD_size_t*
 
             /* bits 11...29 must be zero, PDO must be disabled on change, CAN_ID == 0 is
              * not allowed, mapping must be configured before enabling the PDO */
-            if (((COB_ID & 0x3FFFF800U) != 0U) || (valid && (PDO->valid && (CAN_ID != PDO->configuredCanId)))
-                || (valid && CO_IS_RESTRICTED_CAN_ID(CAN_ID)) || (valid && (PDO->mappedObjectsCount == 0U))) {
+            if (((COB_ID & 0x3FFFF800U) != 0U)
+                || (valid && (PDO->valid && (CAN_ID != CO_PDO_COLD(PDO)->configuredCanId)))
+                || (valid && CO_IS_RESTRICTED_CAN_ID(CAN_ID)) || (valid && (PDO->dataLength == 0U))) {
                 return ODR_INVALID_VALUE;
             }
 
             /* parameter changed? */
-            if ((valid != PDO->valid) || (CAN_ID != PDO->configuredCanId)) {
+            if ((valid != PDO->valid) || (CAN_ID != CO_PDO_COLD(PDO)->configuredCanId)) {
                 /* if default CAN-ID is written, store to OD without Node-ID */
-                if (CAN_ID == PDO->preDefinedCanId) {
+                if (CAN_ID == CO_PDO_COLD(PDO)->preDefinedCanId) {
                     (void)CO_setUint32(bufCopy, COB_ID & 0xFFFFFF80U);
                 }
                 if (!valid) {
@@ -982,7 +2163,7 @@ OD_write_18xx(OD_stream_t* stream, const void* buf, OD_size_t count, OD_size_t*
                 }
 
                 CO_CANtx_t* CANtxBuff = CO_CANtxBufferInit(
-                    PDO->CANdev, PDO->CANdevIdx, CAN_ID, false, PDO->dataLength,
+                    PDO->CANdev, CO_PDO_COLD(PDO)->CANdevIdx, CAN_ID, false, PDO->dataLength,
                     TPDO->transmissionType <= (uint8_t)CO_PDO_TRANSM_TYPE_SYNC_240);
 
                 if (CANtxBuff == NULL) {
@@ -991,7 +2172,7 @@ OD_write_18xx(OD_stream_t* stream, const void* buf, OD_size_t count, OD_size_t*
 
                 TPDO->CANtxBuff = CANtxBuff;
                 PDO->valid = valid;
-                PDO->configuredCanId = CAN_ID;
+                CO_PDO_COLD(PDO)->configuredCanId = CAN_ID;
             }
             break;
         }
@@ -1004,6 +2185,12 @@ OD_write_18xx(OD_stream_t* stream, const void* buf, OD_size_t count, OD_size_t*
             }
             TPDO->CANtxBuff->syncFlag = transmissionType <= (uint8_t)CO_PDO_TRANSM_TYPE_SYNC_240;
             TPDO->syncCounter = 255;
+#if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_SYNC_BALANCE) != 0
+            /* phase from balancing is not valid for different transmission type */
+            if (transmissionType != TPDO->transmissionType) {
+                TPDO->syncPhase = CO_PDO_SYNC_PHASE_AUTO;
+            }
+#endif
 #else
             if (transmissionType < CO_PDO_TRANSM_TYPE_SYNC_EVENT_LO) {
                 return ODR_INVALID_VALUE;
@@ -1062,6 +2249,9 @@ CO_ReturnError_t
 CO_TPDO_init(CO_TPDO_t* TPDO, OD_t* OD, CO_EM_t* em,
 #if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_SYNC_ENABLE) != 0
              CO_SYNC_t* SYNC,
+#endif
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_COLD_SPLIT) != 0
+             CO_PDO_cold_t* cold,
 #endif
              uint16_t preDefinedCanId, OD_entry_t* OD_18xx_TPDOCommPar, OD_entry_t* OD_1Axx_TPDOMapPar,
              CO_CANmodule_t* CANdevTx, uint16_t CANdevTxIdx, uint32_t* errInfo) {
@@ -1073,9 +2263,18 @@ CO_TPDO_init(CO_TPDO_t* TPDO, OD_t* OD, CO_EM_t* em,
         || (CANdevTx == NULL)) {
         return CO_ERROR_ILLEGAL_ARGUMENT;
     }
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_COLD_SPLIT) != 0
+    if (cold == NULL) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
+#endif
 
     /* clear object */
     (void)memset(TPDO, 0, sizeof(CO_TPDO_t));
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_COLD_SPLIT) != 0
+    (void)memset(cold, 0, sizeof(CO_PDO_cold_t));
+    PDO->cold = cold;
+#endif
 
     /* Configure object variables */
     PDO->em = em;
@@ -1119,7 +2318,7 @@ CO_TPDO_init(CO_TPDO_t* TPDO, OD_t* OD, CO_EM_t* em,
 
     bool_t valid = (COB_ID & 0x80000000U) == 0U;
     uint16_t CAN_ID = (uint16_t)(COB_ID & 0x7FFU);
-    if (valid && ((PDO->mappedObjectsCount == 0U) || (CAN_ID == 0U))) {
+    if (valid && ((PDO->dataLength == 0U) || (CAN_ID == 0U))) {
         valid = false;
         if (erroneousMap == 0U) {
             erroneousMap = 1;
@@ -1170,27 +2369,361 @@ CO_TPDO_init(CO_TPDO_t* TPDO, OD_t* OD, CO_EM_t* em,
     TPDO->SYNC = SYNC;
     TPDO->syncCounter = 255;
 #endif
+#if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_SYNC_BALANCE) != 0
+    TPDO->syncPhase = CO_PDO_SYNC_PHASE_AUTO;
+#endif
 
     /* Configure OD extensions */
 #if ((CO_CONFIG_PDO)&CO_CONFIG_FLAG_OD_DYNAMIC) != 0
-    PDO->isRPDO = false;
-    PDO->OD = OD;
-    PDO->CANdevIdx = CANdevTxIdx;
-    PDO->preDefinedCanId = preDefinedCanId;
-    PDO->configuredCanId = CAN_ID;
-    PDO->OD_communicationParam_ext.object = TPDO;
-    PDO->OD_communicationParam_ext.read = OD_read_PDO_commParam;
-    PDO->OD_communicationParam_ext.write = OD_write_18xx;
-    PDO->OD_mappingParam_extension.object = TPDO;
-    PDO->OD_mappingParam_extension.read = OD_readOriginal;
-    PDO->OD_mappingParam_extension.write = OD_write_PDO_mapping;
-    (void)OD_extension_init(OD_18xx_TPDOCommPar, &PDO->OD_communicationParam_ext);
-    (void)OD_extension_init(OD_1Axx_TPDOMapPar, &PDO->OD_mappingParam_extension);
+    CO_PDO_COLD(PDO)->isRPDO = false;
+    CO_PDO_COLD(PDO)->OD = OD;
+    CO_PDO_COLD(PDO)->CANdevIdx = CANdevTxIdx;
+    CO_PDO_COLD(PDO)->preDefinedCanId = preDefinedCanId;
+    CO_PDO_COLD(PDO)->configuredCanId = CAN_ID;
+    CO_PDO_COLD(PDO)->OD_communicationParam_ext.object = TPDO;
+    CO_PDO_COLD(PDO)->OD_communicationParam_ext.read = OD_read_PDO_commParam;
+    CO_PDO_COLD(PDO)->OD_communicationParam_ext.write = OD_write_18xx;
+    CO_PDO_COLD(PDO)->OD_mappingParam_extension.object = TPDO;
+    CO_PDO_COLD(PDO)->OD_mappingParam_extension.read = OD_readOriginal;
+    CO_PDO_COLD(PDO)->OD_mappingParam_extension.write = OD_write_PDO_mapping;
+    (void)OD_extension_init(OD_18xx_TPDOCommPar, &CO_PDO_COLD(PDO)->OD_communicationParam_ext);
+    (void)OD_extension_init(OD_1Axx_TPDOMapPar, &CO_PDO_COLD(PDO)->OD_mappingParam_extension);
+#endif
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_STAGED_MAPPING) != 0
+    CO_PDO_COLD(PDO)->OD_communicationParam = OD_18xx_TPDOCommPar;
+    CO_PDO_COLD(PDO)->OD_mappingParam = OD_1Axx_TPDOMapPar;
 #endif
 
     return CO_ERROR_NO;
 }
 
+#if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_COPY_PLAN) != 0) && (((CO_CONFIG_PDO)&CO_CONFIG_PDO_BITWISE_MAPPING) == 0)
+/*
+ * Read one mapped entry from OD variable into TPDO data with OD_IO read() function.
+ *
+ * Used by copy plan for entries, which can not be copied directly.
+ *
+ * @param OD_IO Object dictionary interface of the mapped entry.
+ * @param dataTPDO Pointer to data of the entry inside TPDO.
+ */
+static void
+PDO_readEntry(OD_IO_t* OD_IO, uint8_t* dataTPDO) {
+    OD_stream_t* stream = &OD_IO->stream;
+    uint8_t mappedLength = (uint8_t)stream->dataOffset;
+    OD_size_t ODdataLength = stream->dataLength;
+    if (ODdataLength > CO_PDO_MAX_SIZE) {
+        ODdataLength = CO_PDO_MAX_SIZE;
+    }
+
+    uint8_t buf[CO_PDO_MAX_SIZE];
+    (void)memset(buf, 0, sizeof(buf));
+
+    /* Set stream.dataOffset to zero, perform OD_IO.read() and store mappedLength back to stream.dataOffset */
+    stream->dataOffset = 0;
+    OD_size_t countRd;
+    (void)OD_IO->read(stream, buf, ODdataLength, &countRd);
+    stream->dataOffset = mappedLength;
+
+    /* swap multibyte data if big-endian */
+#ifdef CO_BIG_ENDIAN
+    if ((stream->attribute & ODA_MB) != 0) {
+        uint8_t* lo = buf;
+        uint8_t* hi = buf + ODdataLength - 1;
+        while (lo < hi) {
+            uint8_t swap = *lo;
+            *lo++ = *hi;
+            *hi-- = swap;
+        }
+    }
+#endif
+
+    (void)memcpy(dataTPDO, buf, mappedLength);
+}
+#endif /* (CO_CONFIG_PDO) & CO_CONFIG_PDO_COPY_PLAN */
+
+#if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_COS) != 0
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_OD_IO_ACCESS) != 0
+/*
+ * Get value of mapped entry from TPDO data (little-endian), which is up to 64 bits long.
+ *
+ * @param data TPDO data.
+ * @param bitOffset Position of the entry inside TPDO data in bits.
+ * @param bits Length of the entry in bits, 1 to 64.
+ *
+ * @return Value of the entry, not sign extended.
+ */
+static uint64_t
+CO_TPDO_cosValue(const uint8_t* data, uint16_t bitOffset, uint8_t bits) {
+    uint8_t shift = (uint8_t)(bitOffset & 7U);
+    uint8_t bytes = (uint8_t)((shift + bits + 7U) / 8U);
+    const uint8_t* src = &data[bitOffset / 8U];
+    uint64_t value = 0;
+
+    for (uint8_t i = 0; i < bytes; i++) {
+        value |= (uint64_t)src[i] << (8U * i);
+    }
+    value >>= shift;
+    return (bits < 64U) ? (value & ((UINT64_C(1) << bits) - 1U)) : value;
+}
+#endif /* (CO_CONFIG_PDO) & CO_CONFIG_PDO_OD_IO_ACCESS */
+
+/*
+ * Verify, if newly assembled TPDO data differ meaningfully from the last transmitted data.
+ *
+ * @param TPDO TPDO object.
+ * @param data Newly assembled TPDO data.
+ * @param dataSize Size of TPDO data in bytes.
+ *
+ * @return true, if TPDO should be sent.
+ */
+static bool_t
+CO_TPDO_cosChanged(const CO_TPDO_t* TPDO, const uint8_t* data, uint8_t dataSize) {
+    if (memcmp(data, TPDO->cosData, dataSize) == 0) {
+        return false;
+    }
+
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_OD_IO_ACCESS) != 0
+    if (TPDO->cosMode == (uint8_t)CO_TPDO_COS_DEADBAND) {
+        const CO_PDO_common_t* PDO = &TPDO->PDO_common;
+        uint16_t bitOffset = 0;
+
+        for (uint8_t i = 0; i < PDO->mappedObjectsCount; i++) {
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_BITWISE_MAPPING) != 0
+            uint16_t bits = (uint16_t)CO_PDO_COLD(PDO)->OD_IO[i].stream.dataOffset;
+#else
+            uint16_t bits = (uint16_t)CO_PDO_COLD(PDO)->OD_IO[i].stream.dataOffset * 8U;
+#endif
+            uint16_t pos = bitOffset;
+            bitOffset += bits;
+            if (bits == 0U) {
+                continue;
+            }
+            if (bits > 64U) {
+                /* not an integer, any change is meaningful */
+                if (memcmp(&data[pos / 8U], &TPDO->cosData[pos / 8U], bits / 8U) != 0) {
+                    return true;
+                }
+                continue;
+            }
+
+            uint64_t valNew = CO_TPDO_cosValue(data, pos, (uint8_t)bits);
+            uint64_t valOld = CO_TPDO_cosValue(TPDO->cosData, pos, (uint8_t)bits);
+            if (valNew == valOld) {
+                continue;
+            }
+
+            /* Convert signed values to offset binary, so they can be compared as unsigned. */
+            uint64_t magnitude = valOld;
+            if ((TPDO->cosFlags[i] & (uint8_t)CO_TPDO_COS_SIGNED) != 0U) {
+                uint64_t signBit = UINT64_C(1) << (bits - 1U);
+                magnitude = ((valOld & signBit) != 0U) ? ((signBit << 1) - valOld) : valOld;
+                valNew ^= signBit;
+                valOld ^= signBit;
+            }
+            uint64_t difference = (valNew > valOld) ? (valNew - valOld) : (valOld - valNew);
+
+            uint64_t deadband = TPDO->cosDeadband[i];
+            if ((TPDO->cosFlags[i] & (uint8_t)CO_TPDO_COS_RELATIVE) != 0U) {
+                deadband = ((magnitude / 1000U) * deadband) + (((magnitude % 1000U) * deadband) / 1000U);
+            }
+            if (difference > deadband) {
+                return true;
+            }
+        }
+        return false;
+    }
+#endif /* (CO_CONFIG_PDO) & CO_CONFIG_PDO_OD_IO_ACCESS */
+
+    return true;
+}
+#endif /* (CO_CONFIG_PDO) & CO_CONFIG_TPDO_COS */
+
+#if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_LATENCY) != 0
+/*
+ * Add latency sample to the statistics. Sample is late, if it is larger than synchronous window length.
+ */
+static void
+CO_TPDO_latencyAdd(CO_TPDO_latencyStat_t* stat, const CO_TPDO_t* TPDO, uint32_t latency_us) {
+    uint32_t bin = latency_us / CO_TPDO_LATENCY_BIN_US;
+    if (bin >= CO_TPDO_LATENCY_BINS) {
+        bin = CO_TPDO_LATENCY_BINS - 1U;
+    }
+    stat->histogram[bin]++;
+    stat->count++;
+    if (latency_us < stat->min_us) {
+        stat->min_us = latency_us;
+    }
+    if (latency_us > stat->max_us) {
+        stat->max_us = latency_us;
+    }
+
+    const uint32_t* window = TPDO->SYNC->OD_1007_window;
+    if ((window != NULL) && (*window > 0U) && (latency_us > *window)) {
+        stat->late++;
+    }
+}
+
+/*
+ * Measure latency from SYNC to CO_CANsend() of synchronous TPDO, which is just being sent.
+ */
+static void
+CO_TPDO_latencySend(CO_TPDO_t* TPDO) {
+    CO_TPDO_latencyClock_t* clock = TPDO->latencyClock;
+
+    if ((clock == NULL) || (clock->getTime_us == NULL) || !clock->syncValid || (TPDO->SYNC == NULL)
+        || (TPDO->transmissionType > (uint8_t)CO_PDO_TRANSM_TYPE_SYNC_240)) {
+        return;
+    }
+
+    TPDO->latencySyncTime_us = clock->syncTime_us;
+    CO_TPDO_latencyAdd(&TPDO->latencySend, TPDO, clock->getTime_us(clock->object) - TPDO->latencySyncTime_us);
+    CO_FLAG_SET(TPDO->latencyTxPending);
+}
+#endif /* (CO_CONFIG_PDO) & CO_CONFIG_TPDO_LATENCY */
+
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_MPDO) != 0
+/*
+ * Find next OD variable from object scanner list for SAM MPDO.
+ *
+ * Entries, which does not point to OD variable mappable to TPDO and up to four bytes long, are skipped. After the end
+ * of the list is reached, next call starts from the beginning of the list.
+ *
+ * @param TPDO TPDO object.
+ * @param [out] OD_IO OD variable, which will be transmitted.
+ *
+ * @return True, if object was found, false at the end of the list.
+ */
+static bool_t
+CO_TPDO_scanMPDO(CO_TPDO_t* TPDO, OD_IO_t* OD_IO) {
+    uint8_t count = 0;
+
+    if ((TPDO->mpdoScanner == NULL) || (OD_get_u8(TPDO->mpdoScanner, 0, &count, true) != ODR_OK)) {
+        return false;
+    }
+
+    for (uint16_t i = 0; i <= count; i++) {
+        if (TPDO->mpdoScanSub == 0U) {
+            TPDO->mpdoScanSub = 1;
+            TPDO->mpdoScanBlock = 0;
+        }
+        if (TPDO->mpdoScanSub > count) {
+            TPDO->mpdoScanSub = 0;
+            break;
+        }
+
+        uint32_t val = 0;
+        (void)OD_get_u32(TPDO->mpdoScanner, TPDO->mpdoScanSub, &val, true);
+        uint8_t blockSize = (uint8_t)(val >> 24);
+        uint16_t subIndex = (uint16_t)(val & 0xFFU) + TPDO->mpdoScanBlock;
+        bool_t found = false;
+
+        if ((val != 0U) && (subIndex <= 0xFFU)) {
+            OD_entry_t* entry = OD_find(TPDO->mpdoOD, (uint16_t)(val >> 8));
+            found = (OD_getSub(entry, (uint8_t)subIndex, OD_IO, false) == ODR_OK)
+                    && ((OD_IO->stream.attribute & ODA_TPDO) != 0U) && (OD_IO->stream.dataLength > 0U)
+                    && (OD_IO->stream.dataLength <= 4U);
+        }
+
+        /* advance to the next object */
+        TPDO->mpdoScanBlock++;
+        if (!found || (TPDO->mpdoScanBlock >= blockSize)) {
+            TPDO->mpdoScanBlock = 0;
+            TPDO->mpdoScanSub++;
+        }
+        if (found) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*
+ * Send MPDO message.
+ *
+ * DAM MPDO contains OD variable from mapping, SAM MPDO contains next variable from object scanner list.
+ *
+ * @param TPDO TPDO object.
+ *
+ * @return Same as CO_CANsend().
+ */
+static CO_ReturnError_t
+CO_TPDO_sendMPDO(CO_TPDO_t* TPDO) {
+    CO_PDO_common_t* PDO = &TPDO->PDO_common;
+    uint8_t* dataTPDO = &TPDO->CANtxBuff->data[0];
+    OD_IO_t OD_IOscan;
+    OD_IO_t* OD_IO;
+    OD_size_t mappedLength;
+
+    /* each MPDO carries different object, previous MPDO must be sent first */
+    if (TPDO->CANtxBuff->bufferFull) {
+        return CO_ERROR_TX_BUSY;
+    }
+
+    if (PDO->mpdoMode == (uint8_t)CO_PDO_MPDO_DAM) {
+        OD_IO = &CO_PDO_COLD(PDO)->OD_IO[0];
+        mappedLength = OD_IO->stream.dataOffset;
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_BITWISE_MAPPING) != 0
+        mappedLength /= 8U;
+#endif
+        dataTPDO[0] = 0x80U | TPDO->mpdoDestNodeId;
+    } else {
+        if (!CO_TPDO_scanMPDO(TPDO, &OD_IOscan)) {
+            /* End of the list, request is completed. Cyclic synchronous MPDO continues from the beginning. */
+            bool_t cyclic = (TPDO->transmissionType != (uint8_t)CO_PDO_TRANSM_TYPE_SYNC_ACYCLIC)
+                            && (TPDO->transmissionType < (uint8_t)CO_PDO_TRANSM_TYPE_SYNC_EVENT_LO);
+            TPDO->sendRequest = false;
+            if (!cyclic || !CO_TPDO_scanMPDO(TPDO, &OD_IOscan)) {
+                return CO_ERROR_NO;
+            }
+        }
+        OD_IO = &OD_IOscan;
+        mappedLength = OD_IO->stream.dataLength;
+        dataTPDO[0] = TPDO->mpdoNodeId & 0x7FU;
+    }
+    dataTPDO[1] = (uint8_t)OD_IO->stream.index;
+    dataTPDO[2] = (uint8_t)(OD_IO->stream.index >> 8);
+    dataTPDO[3] = OD_IO->stream.subIndex;
+
+    /* Set stream.dataOffset to zero, perform OD_IO.read() and restore stream.dataOffset */
+    uint8_t buf[4] = {0, 0, 0, 0};
+    OD_size_t dataOffset = OD_IO->stream.dataOffset;
+    OD_size_t countRd;
+    OD_IO->stream.dataOffset = 0;
+    (void)OD_IO->read(&OD_IO->stream, buf, OD_IO->stream.dataLength, &countRd);
+    OD_IO->stream.dataOffset = dataOffset;
+#ifdef CO_BIG_ENDIAN
+    if ((OD_IO->stream.attribute & ODA_MB) != 0U) {
+        PDO_swapMPDO(buf, OD_IO->stream.dataLength);
+    }
+#endif
+    (void)memset(&dataTPDO[4], 0, 4);
+    (void)memcpy(&dataTPDO[4], buf, mappedLength);
+
+#if OD_FLAGS_PDO_SIZE > 0
+    /* In event driven TPDO indicate transmission of OD variable */
+    if ((PDO->mappedObjectsCount > 0U) && (PDO->flagPDObyte[0] != NULL)
+        && ((TPDO->transmissionType == (uint8_t)CO_PDO_TRANSM_TYPE_SYNC_ACYCLIC)
+            || (TPDO->transmissionType >= (uint8_t)CO_PDO_TRANSM_TYPE_SYNC_EVENT_LO))) {
+        *PDO->flagPDObyte[0] |= PDO->flagPDObitmask[0];
+    }
+#endif
+
+    /* SAM MPDO request is completed after all objects from the scanner list are sent */
+    if (PDO->mpdoMode == (uint8_t)CO_PDO_MPDO_DAM) {
+        TPDO->sendRequest = false;
+    }
+#if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_TIMERS_ENABLE) != 0
+    TPDO->eventTimer = TPDO->eventTime_us;
+    TPDO->inhibitTimer = TPDO->inhibitTime_us;
+#endif
+#if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_LATENCY) != 0
+    CO_TPDO_latencySend(TPDO);
+#endif
+    return CO_CANsend(PDO->CANdev, TPDO->CANtxBuff);
+}
+#endif /* (CO_CONFIG_PDO) & CO_CONFIG_PDO_MPDO */
+
 /*
  * Send TPDO message.
  *
@@ -1204,20 +2737,91 @@ CO_TPDO_init(CO_TPDO_t* TPDO, OD_t* OD, CO_EM_t* em,
 static CO_ReturnError_t
 CO_TPDOsend(CO_TPDO_t* TPDO) {
     CO_PDO_common_t* PDO = &TPDO->PDO_common;
+#if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_COS) != 0
+    /* Without request, event driven TPDO in COS mode is assembled into auxiliary buffer and sent only on change */
+    uint8_t dataCOS[CO_PDO_MAX_SIZE];
+    bool_t cosCheck = (TPDO->cosMode != (uint8_t)CO_TPDO_COS_OFF) && !TPDO->sendRequest
+                      && ((TPDO->transmissionType == (uint8_t)CO_PDO_TRANSM_TYPE_SYNC_ACYCLIC)
+                          || (TPDO->transmissionType >= (uint8_t)CO_PDO_TRANSM_TYPE_SYNC_EVENT_LO));
+    uint8_t* dataTPDO = cosCheck ? &dataCOS[0] : &TPDO->CANtxBuff->data[0];
+#else
     uint8_t* dataTPDO = &TPDO->CANtxBuff->data[0];
+#endif
     OD_size_t verifyLength = 0U;
 
-#if OD_FLAGS_PDO_SIZE > 0
-    bool_t eventDriven = ((TPDO->transmissionType == (uint8_t)CO_PDO_TRANSM_TYPE_SYNC_ACYCLIC)
-                          || (TPDO->transmissionType >= (uint8_t)CO_PDO_TRANSM_TYPE_SYNC_EVENT_LO));
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_MPDO) != 0
+    if (PDO->mpdoMode != 0U) {
+#if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_COS) != 0
+        if (cosCheck) {
+            return CO_ERROR_NO;
+        }
+#endif
+        return CO_TPDO_sendMPDO(TPDO);
+    }
+#endif
+
+#if OD_FLAGS_PDO_SIZE > 0
+    bool_t eventDriven = ((TPDO->transmissionType == (uint8_t)CO_PDO_TRANSM_TYPE_SYNC_ACYCLIC)
+                          || (TPDO->transmissionType >= (uint8_t)CO_PDO_TRANSM_TYPE_SYNC_EVENT_LO));
+#endif
+
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_COPY_PLAN) != 0
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_BITWISE_MAPPING) != 0
+    uint64_t buf64 = 0;
+    for (uint8_t i = 0; i < PDO->copyRunsCount; i++) {
+        const CO_PDO_copyRun_t* run = &PDO->copyRun[i];
+
+        /* additional safety check */
+        verifyLength += (OD_size_t)run->bits;
+        if (verifyLength > (CO_PDO_MAX_SIZE * 8U)) {
+            break;
+        }
+
+        /* get value of OD variable and pack mapped bits into PDO data */
+        uint64_t value = 0;
+        uint8_t* dataOD = (uint8_t*)&value + run->valueOffset;
+
+        if (run->dataOD != NULL) {
+            (void)memcpy(dataOD, run->dataOD, run->length);
+        } else {
+            OD_stream_t* stream = &CO_PDO_COLD(PDO)->OD_IO[run->mapIndex].stream;
+            OD_size_t countRd;
+            stream->dataOffset = 0;
+            (void)CO_PDO_COLD(PDO)->OD_IO[run->mapIndex].read(stream, dataOD, run->length, &countRd);
+            stream->dataOffset = run->bits;
+        }
+        buf64 |= (value & run->mask) << run->shift;
+    }
+#else
+    for (uint8_t i = 0; i < PDO->copyRunsCount; i++) {
+        const CO_PDO_copyRun_t* run = &PDO->copyRun[i];
+
+        /* additional safety check */
+        verifyLength += (OD_size_t)run->length;
+        if (verifyLength > CO_PDO_MAX_SIZE) {
+            break;
+        }
+
+        if (run->dataOD == NULL) {
+            PDO_readEntry(&CO_PDO_COLD(PDO)->OD_IO[run->mapIndex], &dataTPDO[run->offset]);
+        }
+#ifdef CO_BIG_ENDIAN
+        else if (run->swap) {
+            PDO_copySwap(&dataTPDO[run->offset], run->dataOD, run->length);
+        }
 #endif
+        else {
+            (void)memcpy(&dataTPDO[run->offset], run->dataOD, run->length);
+        }
+    }
+#endif /* (CO_CONFIG_PDO) & CO_CONFIG_PDO_BITWISE_MAPPING */
 
-#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_OD_IO_ACCESS) != 0
+#elif ((CO_CONFIG_PDO)&CO_CONFIG_PDO_OD_IO_ACCESS) != 0
 #if ((CO_CONFIG_PDO) & (CO_CONFIG_PDO_BITWISE_MAPPING)) != 0
         uint64_t buf64 = 0;
 #endif
     for (uint8_t i = 0; i < PDO->mappedObjectsCount; i++) {
-        OD_IO_t* OD_IO = &PDO->OD_IO[i];
+        OD_IO_t* OD_IO = &CO_PDO_COLD(PDO)->OD_IO[i];
         OD_stream_t* stream = &OD_IO->stream;
 
         /* get mappedLength from temporary storage */
@@ -1291,30 +2895,49 @@ CO_TPDOsend(CO_TPDO_t* TPDO) {
         }
 #endif /* (CO_CONFIG_PDO) & (CO_CONFIG_PDO_BITWISE_MAPPING) == 0*/
 
-        /* In event driven TPDO indicate transmission of OD variable */
-#if OD_FLAGS_PDO_SIZE > 0
-        uint8_t* flagPDObyte = PDO->flagPDObyte[i];
-        if ((flagPDObyte != NULL) && eventDriven) {
-            *flagPDObyte |= PDO->flagPDObitmask[i];
-        }
-#endif
-
 #if ((CO_CONFIG_PDO) & (CO_CONFIG_PDO_BITWISE_MAPPING)) == 0
         dataTPDO += mappedLength;
 #endif
     }
 #else
-    verifyLength = (OD_size_t)PDO->dataLength;
-    for (uint8_t i = 0; i < PDO->dataLength; i++) {
-        dataTPDO[i] = *PDO->mapPointer[i];
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_BITWISE_MAPPING) != 0
+    uint64_t buf64 = 0;
+#endif
+    for (uint8_t i = 0; i < PDO->mappedObjectsCount; i++) {
+        const CO_PDO_directMap_t* directMap = &PDO->directMap[i];
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_BITWISE_MAPPING) != 0
+        uint8_t shift = (uint8_t)verifyLength;
 
-        /* In event driven TPDO indicate transmission of OD variable */
-#if OD_FLAGS_PDO_SIZE > 0
-        uint8_t* flagPDObyte = PDO->flagPDObyte[i];
-        if (flagPDObyte != NULL && eventDriven) {
-            *flagPDObyte |= PDO->flagPDObitmask[i];
+        /* additional safety check */
+        verifyLength += (OD_size_t)directMap->bits;
+        if (verifyLength > (CO_PDO_MAX_SIZE * 8U)) {
+            break;
+        }
+
+        /* get value of OD variable and pack mapped bits into PDO data */
+        uint64_t value = 0;
+        (void)memcpy((uint8_t*)&value + CO_PDO_VALUE_OFFSET(directMap->length), PDO->directDataOD[i],
+                     directMap->length);
+        if (directMap->bits > 0U) {
+            buf64 |= (value & (UINT64_MAX >> (64U - directMap->bits))) << shift;
+        }
+#else
+        /* additional safety check */
+        verifyLength += (OD_size_t)directMap->length;
+        if (verifyLength > CO_PDO_MAX_SIZE) {
+            break;
         }
+
+#ifdef CO_BIG_ENDIAN
+        if (directMap->swap != 0U) {
+            PDO_copySwap(dataTPDO, PDO->directDataOD[i], directMap->length);
+        } else
 #endif
+        {
+            (void)memcpy(dataTPDO, PDO->directDataOD[i], directMap->length);
+        }
+        dataTPDO += directMap->length;
+#endif /* (CO_CONFIG_PDO) & CO_CONFIG_PDO_BITWISE_MAPPING */
     }
 #endif /* (CO_CONFIG_PDO) & CO_CONFIG_PDO_OD_IO_ACCESS */
 
@@ -1336,14 +2959,95 @@ CO_TPDOsend(CO_TPDO_t* TPDO) {
     (void)memcpy(dataTPDO, &buf64, CO_PDO_MAX_SIZE);
 #endif /* (CO_CONFIG_PDO) & (CO_CONFIG_PDO_BITWISE_MAPPING) */
 
+#if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_COS) != 0
+    if (TPDO->cosMode != (uint8_t)CO_TPDO_COS_OFF) {
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_BITWISE_MAPPING) != 0
+        uint8_t dataSize = (uint8_t)((PDO->dataLength + 7U) / 8U);
+#else
+        uint8_t dataSize = (uint8_t)PDO->dataLength;
+#endif
+        if (cosCheck) {
+            if (!CO_TPDO_cosChanged(TPDO, dataCOS, dataSize)) {
+                return CO_ERROR_NO;
+            }
+            (void)memcpy(&TPDO->CANtxBuff->data[0], dataCOS, dataSize);
+        }
+        (void)memcpy(TPDO->cosData, &TPDO->CANtxBuff->data[0], dataSize);
+    }
+#endif
+
+    /* In event driven TPDO indicate transmission of OD variables, only if TPDO is sent */
+#if OD_FLAGS_PDO_SIZE > 0
+    if (eventDriven) {
+        for (uint8_t i = 0; i < PDO->mappedObjectsCount; i++) {
+            uint8_t* flagPDObyte = PDO->flagPDObyte[i];
+            if (flagPDObyte != NULL) {
+                *flagPDObyte |= PDO->flagPDObitmask[i];
+            }
+        }
+    }
+#endif
+
     TPDO->sendRequest = false;
 #if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_TIMERS_ENABLE) != 0
     TPDO->eventTimer = TPDO->eventTime_us;
     TPDO->inhibitTimer = TPDO->inhibitTime_us;
+#endif
+#if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_LATENCY) != 0
+    CO_TPDO_latencySend(TPDO);
 #endif
     return CO_CANsend(PDO->CANdev, TPDO->CANtxBuff);
 }
 
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_STAGED_MAPPING) != 0
+ODR_t
+CO_TPDO_stageMapping(CO_TPDO_t* TPDO, CO_PDO_stagedMap_t* stagedMap, const uint32_t* map,
+                     uint8_t mappedObjectsCount, uint16_t CAN_ID) {
+    if ((TPDO == NULL) || (stagedMap == NULL) || (map == NULL)) {
+        return ODR_DEV_INCOMPAT;
+    }
+    if (TPDO->stagedMap != NULL) {
+        return ODR_DATA_DEV_STATE;
+    }
+
+    ODR_t odRet = PDO_stageMapping(&TPDO->PDO_common, stagedMap, map, mappedObjectsCount, CAN_ID);
+    if (odRet == ODR_OK) {
+        TPDO->stagedMap = stagedMap;
+    }
+    return odRet;
+}
+
+/*
+ * Swap staged mapping into TPDO and reconfigure CAN transmit buffer for new length and CAN identifier.
+ */
+static void
+CO_TPDO_swapMapping(CO_TPDO_t* TPDO) {
+    CO_PDO_common_t* PDO = &TPDO->PDO_common;
+    CO_PDO_stagedMap_t* stagedMap = TPDO->stagedMap;
+
+    TPDO->stagedMap = NULL;
+    bool_t changeCanId = PDO_swapMapping(PDO, stagedMap);
+    if (PDO->valid) {
+        uint16_t CAN_ID = changeCanId ? stagedMap->CAN_ID : CO_PDO_COLD(PDO)->configuredCanId;
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_BITWISE_MAPPING) != 0
+        uint8_t DLC = (uint8_t)((PDO->dataLength + 7U) / 8U);
+#else
+        uint8_t DLC = (uint8_t)PDO->dataLength;
+#endif
+        bool_t syncFlag = TPDO->transmissionType <= (uint8_t)CO_PDO_TRANSM_TYPE_SYNC_240;
+        CO_CANtx_t* CANtxBuff = CO_CANtxBufferInit(PDO->CANdev, CO_PDO_COLD(PDO)->CANdevIdx, CAN_ID, false, DLC,
+                                                   syncFlag);
+        if (CANtxBuff != NULL) {
+            TPDO->CANtxBuff = CANtxBuff;
+            CO_PDO_COLD(PDO)->configuredCanId = CAN_ID;
+        } else {
+            PDO->valid = false;
+        }
+    }
+    TPDO->sendRequest = true;
+}
+#endif /* (CO_CONFIG_PDO) & CO_CONFIG_PDO_STAGED_MAPPING */
+
 void
 CO_TPDO_process(CO_TPDO_t* TPDO,
 #if (((CO_CONFIG_PDO)&CO_CONFIG_TPDO_TIMERS_ENABLE) != 0) || defined CO_DOXYGEN
@@ -1356,6 +3060,15 @@ CO_TPDO_process(CO_TPDO_t* TPDO,
 #endif
     (void)syncWas;
 
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_STAGED_MAPPING) != 0
+    /* Synchronous TPDO swaps staged mapping at SYNC, before it is assembled */
+    if ((TPDO->stagedMap != NULL)
+        && (!PDO->valid || !NMTisOperational || syncWas
+            || (TPDO->transmissionType >= (uint8_t)CO_PDO_TRANSM_TYPE_SYNC_EVENT_LO))) {
+        CO_TPDO_swapMapping(TPDO);
+    }
+#endif
+
     if (PDO->valid && NMTisOperational) {
 
         /* check for event timer or application event */
@@ -1394,15 +3107,36 @@ CO_TPDO_process(CO_TPDO_t* TPDO,
         }
 #endif /* ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_TIMERS_ENABLE)||(OD_FLAGS_PDO_SIZE>0) */
 
+        /* In COS mode synchronous acyclic TPDO is also checked for change of value on each SYNC, CO_TPDOsend()
+         * decides */
+#if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_COS) != 0
+        bool_t sendCheck = TPDO->sendRequest || (TPDO->cosMode != (uint8_t)CO_TPDO_COS_OFF);
+#else
+        bool_t sendCheck = TPDO->sendRequest;
+#endif
+
         /* Send PDO by application request or by Event timer */
         if (TPDO->transmissionType >= (uint8_t)CO_PDO_TRANSM_TYPE_SYNC_EVENT_LO) {
 #if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_TIMERS_ENABLE) != 0
             TPDO->inhibitTimer = (TPDO->inhibitTimer > timeDifference_us) ? (TPDO->inhibitTimer - timeDifference_us)
                                                                           : 0U;
 
+#if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_COS) != 0
+            /* In COS mode event driven TPDO is checked for change of value, when COS check timer expires */
+            bool_t cosDue = false;
+            if (TPDO->cosMode != (uint8_t)CO_TPDO_COS_OFF) {
+                TPDO->cosTimer = (TPDO->cosTimer > timeDifference_us) ? (TPDO->cosTimer - timeDifference_us) : 0U;
+                cosDue = TPDO->cosTimer == 0U;
+            }
+            sendCheck = TPDO->sendRequest || cosDue;
+#endif
+
             /* send TPDO */
-            if (TPDO->sendRequest && (TPDO->inhibitTimer == 0U)) {
+            if (sendCheck && (TPDO->inhibitTimer == 0U)) {
                 (void)CO_TPDOsend(TPDO);
+#if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_COS) != 0
+                TPDO->cosTimer = TPDO->cosCheckTime_us;
+#endif
             }
 
 #if ((CO_CONFIG_PDO)&CO_CONFIG_FLAG_TIMERNEXT) != 0
@@ -1410,9 +3144,18 @@ CO_TPDO_process(CO_TPDO_t* TPDO,
                 /* Schedule for just beyond inhibit window */
                 *timerNext_us = TPDO->inhibitTimer;
             }
+#if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_COS) != 0
+            if ((TPDO->cosMode != (uint8_t)CO_TPDO_COS_OFF) && (timerNext_us != NULL)) {
+                /* Schedule for next COS check, not before the end of inhibit window */
+                uint32_t cosNext = (TPDO->cosTimer > TPDO->inhibitTimer) ? TPDO->cosTimer : TPDO->inhibitTimer;
+                if (*timerNext_us > cosNext) {
+                    *timerNext_us = cosNext;
+                }
+            }
+#endif
 #endif
 #else
-            if (TPDO->sendRequest) {
+            if (sendCheck) {
                 (void)CO_TPDOsend(TPDO);
             }
 #endif
@@ -1423,7 +3166,7 @@ CO_TPDO_process(CO_TPDO_t* TPDO,
         else if ((TPDO->SYNC != NULL) && syncWas) {
             /* send synchronous acyclic TPDO */
             if (TPDO->transmissionType == (uint8_t)CO_PDO_TRANSM_TYPE_SYNC_ACYCLIC) {
-                if (TPDO->sendRequest) {
+                if (sendCheck) {
                     (void)CO_TPDOsend(TPDO);
                 }
             }
@@ -1434,7 +3177,14 @@ CO_TPDO_process(CO_TPDO_t* TPDO,
                     if ((TPDO->SYNC->counterOverflowValue != 0U) && (TPDO->syncStartValue != 0U)) {
                         /* syncStartValue is in use */
                         TPDO->syncCounter = 254;
-                    } else {
+                    }
+#if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_SYNC_BALANCE) != 0
+                    else if (TPDO->syncPhase < TPDO->transmissionType) {
+                        /* Send first TPDO after SYNCs according to phase from CO_TPDO_balanceSync() */
+                        TPDO->syncCounter = TPDO->syncPhase + 1U;
+                    }
+#endif
+                    else {
                         /* Send first TPDO somewhere in the middle */
                         TPDO->syncCounter = (TPDO->transmissionType / 2U) + 1U;
                     }
@@ -1470,5 +3220,405 @@ CO_TPDO_process(CO_TPDO_t* TPDO,
 #endif
     }
 }
+
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_MPDO) != 0
+void
+CO_TPDO_initMPDO(CO_TPDO_t* TPDO, OD_t* OD, uint8_t nodeId, OD_entry_t* OD_1FAx_scannerList) {
+    if (TPDO != NULL) {
+        TPDO->mpdoOD = OD;
+        TPDO->mpdoNodeId = nodeId;
+        TPDO->mpdoScanner = OD_1FAx_scannerList;
+        TPDO->mpdoScanSub = 0;
+        TPDO->mpdoScanBlock = 0;
+    }
+}
+#endif /* (CO_CONFIG_PDO) & CO_CONFIG_PDO_MPDO */
+
+#if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_COS) != 0
+void
+CO_TPDO_setCOS(CO_TPDO_t* TPDO, CO_TPDO_cosMode_t mode, uint32_t checkTime_us) {
+    if (TPDO != NULL) {
+        TPDO->cosMode = (uint8_t)mode;
+        TPDO->cosCheckTime_us = checkTime_us;
+        TPDO->cosTimer = checkTime_us;
+        /* obtain new reference data */
+        TPDO->sendRequest = true;
+    }
+}
+
+CO_ReturnError_t
+CO_TPDO_setDeadband(CO_TPDO_t* TPDO, uint8_t mapIndex, uint32_t deadband, uint8_t flags) {
+    if ((TPDO == NULL) || (mapIndex >= TPDO->PDO_common.mappedObjectsCount)) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
+
+    TPDO->cosDeadband[mapIndex] = deadband;
+    TPDO->cosFlags[mapIndex] = flags;
+    return CO_ERROR_NO;
+}
+#endif /* (CO_CONFIG_PDO) & CO_CONFIG_TPDO_COS */
+
+#if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_SYNC_BALANCE) != 0
+/*
+ * Set of cyclic synchronous PDOs for balancing, either arrays of periods and phases or array of TPDO objects.
+ */
+typedef struct {
+    const uint8_t* periods;
+    uint8_t* phases;
+    CO_TPDO_t* TPDOs;
+    uint16_t count;
+} CO_PDO_syncSet_t;
+
+/*
+ * Return true, if TPDO is valid cyclic synchronous TPDO, which does not use SYNC start value.
+ */
+static bool_t
+CO_TPDO_syncBalanced(const CO_TPDO_t* TPDO) {
+    return TPDO->PDO_common.valid && (TPDO->SYNC != NULL)
+           && (TPDO->transmissionType >= (uint8_t)CO_PDO_TRANSM_TYPE_SYNC_1)
+           && (TPDO->transmissionType <= (uint8_t)CO_PDO_TRANSM_TYPE_SYNC_240)
+           && ((TPDO->SYNC->counterOverflowValue == 0U) || (TPDO->syncStartValue == 0U));
+}
+
+/*
+ * Get period and phase of i-th PDO from the set. Return true, if PDO is cyclic synchronous and its phase is assigned.
+ */
+static bool_t
+CO_PDO_syncEntry(const CO_PDO_syncSet_t* set, uint16_t i, uint8_t* period, uint8_t* phase) {
+    bool_t valid;
+
+    if (set->TPDOs != NULL) {
+        const CO_TPDO_t* TPDO = &set->TPDOs[i];
+        valid = CO_TPDO_syncBalanced(TPDO);
+        *period = TPDO->transmissionType;
+        *phase = TPDO->syncPhase;
+    } else {
+        *period = set->periods[i];
+        *phase = set->phases[i];
+        valid = (*period >= (uint8_t)CO_PDO_TRANSM_TYPE_SYNC_1) && (*period <= (uint8_t)CO_PDO_TRANSM_TYPE_SYNC_240);
+    }
+    return valid && (*phase != CO_PDO_SYNC_PHASE_AUTO);
+}
+
+/*
+ * Return number of PDOs with assigned phase, which are transmitted on SYNC number s.
+ */
+static uint16_t
+CO_PDO_syncLoad(const CO_PDO_syncSet_t* set, uint32_t s) {
+    uint16_t load = 0;
+
+    for (uint16_t i = 0; i < set->count; i++) {
+        uint8_t period;
+        uint8_t phase;
+        if (CO_PDO_syncEntry(set, i, &period, &phase) && ((s % period) == phase)) {
+            load++;
+        }
+    }
+    return load;
+}
+
+/*
+ * Return hyperperiod, the least common multiple of period and periods of all PDOs with assigned phase. Load repeats
+ * with hyperperiod, so calculation over it is exact. Result is limited to CO_PDO_SYNC_BALANCE_HORIZON_MAX.
+ */
+static uint32_t
+CO_PDO_syncHyperperiod(const CO_PDO_syncSet_t* set, uint8_t period) {
+    uint32_t hyperperiod = period;
+
+    for (uint16_t i = 0; i < set->count; i++) {
+        uint8_t p;
+        uint8_t phase;
+        if (CO_PDO_syncEntry(set, i, &p, &phase)) {
+            uint32_t a = hyperperiod;
+            uint32_t b = p;
+            while (b != 0U) {
+                uint32_t t = a % b;
+                a = b;
+                b = t;
+            }
+            hyperperiod = (hyperperiod / a) * p;
+            if (hyperperiod > CO_PDO_SYNC_BALANCE_HORIZON_MAX) {
+                return CO_PDO_SYNC_BALANCE_HORIZON_MAX;
+            }
+        }
+    }
+    return hyperperiod;
+}
+
+/*
+ * Find phase of cyclic synchronous PDO, where the largest load is the smallest. If equal, use phase with the smallest
+ * sum of load.
+ */
+static uint8_t
+CO_PDO_syncPhaseFind(const CO_PDO_syncSet_t* set, uint8_t period) {
+    uint32_t hyperperiod = CO_PDO_syncHyperperiod(set, period);
+    uint8_t bestPhase = 0;
+    uint16_t bestPeak = 0xFFFFU;
+    uint32_t bestSum = 0xFFFFFFFFU;
+
+    for (uint8_t phase = 0; phase < period; phase++) {
+        uint16_t peak = 0;
+        uint32_t sum = 0;
+        for (uint32_t s = phase; s < hyperperiod; s += period) {
+            uint16_t load = CO_PDO_syncLoad(set, s);
+            if (load > peak) {
+                peak = load;
+            }
+            sum += load;
+        }
+        if ((peak < bestPeak) || ((peak == bestPeak) && (sum < bestSum))) {
+            bestPhase = phase;
+            bestPeak = peak;
+            bestSum = sum;
+        }
+    }
+    return bestPhase;
+}
+
+/*
+ * Return the largest load of all SYNCs.
+ */
+static uint16_t
+CO_PDO_syncLoadPeak(const CO_PDO_syncSet_t* set) {
+    uint32_t hyperperiod = CO_PDO_syncHyperperiod(set, 1);
+    uint16_t peak = 0;
+
+    for (uint32_t s = 0; s < hyperperiod; s++) {
+        uint16_t load = CO_PDO_syncLoad(set, s);
+        if (load > peak) {
+            peak = load;
+        }
+    }
+    return peak;
+}
+
+uint16_t
+CO_PDO_syncBalance(const uint8_t* periods, uint8_t* phases, uint16_t count) {
+    CO_PDO_syncSet_t set = {periods, phases, NULL, count};
+
+    if ((periods == NULL) || (phases == NULL)) {
+        return 0;
+    }
+
+    /* Fixed phases */
+    for (uint16_t i = 0; i < count; i++) {
+        uint8_t period = periods[i];
+        if ((period >= (uint8_t)CO_PDO_TRANSM_TYPE_SYNC_1) && (period <= (uint8_t)CO_PDO_TRANSM_TYPE_SYNC_240)
+            && (phases[i] != CO_PDO_SYNC_PHASE_AUTO)) {
+            phases[i] %= period;
+        }
+    }
+
+    /* Automatic phases, the most frequent PDOs first */
+    for (uint8_t period = (uint8_t)CO_PDO_TRANSM_TYPE_SYNC_1; period <= (uint8_t)CO_PDO_TRANSM_TYPE_SYNC_240;
+         period++) {
+        for (uint16_t i = 0; i < count; i++) {
+            if ((periods[i] == period) && (phases[i] == CO_PDO_SYNC_PHASE_AUTO)) {
+                phases[i] = CO_PDO_syncPhaseFind(&set, period);
+            }
+        }
+    }
+
+    return CO_PDO_syncLoadPeak(&set);
+}
+
+uint16_t
+CO_TPDO_balanceSync(CO_TPDO_t* TPDOs, uint16_t count) {
+    CO_PDO_syncSet_t set = {NULL, NULL, TPDOs, count};
+
+    if (TPDOs == NULL) {
+        return 0;
+    }
+
+    /* Clear previous phases */
+    for (uint16_t i = 0; i < count; i++) {
+        TPDOs[i].syncPhase = CO_PDO_SYNC_PHASE_AUTO;
+    }
+
+    /* Assign phases, the most frequent TPDOs first. Restart TPDOs, so phases are applied from the same SYNC. */
+    for (uint8_t period = (uint8_t)CO_PDO_TRANSM_TYPE_SYNC_1; period <= (uint8_t)CO_PDO_TRANSM_TYPE_SYNC_240;
+         period++) {
+        for (uint16_t i = 0; i < count; i++) {
+            CO_TPDO_t* TPDO = &TPDOs[i];
+            if ((TPDO->transmissionType == period) && CO_TPDO_syncBalanced(TPDO)) {
+                TPDO->syncPhase = CO_PDO_syncPhaseFind(&set, period);
+                TPDO->syncCounter = 255;
+            }
+        }
+    }
+
+    return CO_PDO_syncLoadPeak(&set);
+}
+#endif /* (CO_CONFIG_PDO) & CO_CONFIG_TPDO_SYNC_BALANCE */
+
+#if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_LATENCY) != 0
+/*
+ * Custom function for reading OD record with TPDO latency statistics
+ *
+ * For more information see file CO_ODinterface.h, OD_IO_t.
+ */
+static ODR_t
+OD_read_TPDOlatency(OD_stream_t* stream, void* buf, OD_size_t count, OD_size_t* countRead) {
+    if ((stream == NULL) || (buf == NULL) || (countRead == NULL)) {
+        return ODR_DEV_INCOMPAT;
+    }
+    if (stream->subIndex == 0U) {
+        return OD_readOriginal(stream, buf, count, countRead);
+    }
+    if (count < sizeof(uint32_t)) {
+        return ODR_DEV_INCOMPAT;
+    }
+
+    CO_TPDO_latency_t* latency = (CO_TPDO_latency_t*)stream->object;
+    const CO_TPDO_t* TPDO = &latency->TPDOs[latency->selected];
+    const CO_TPDO_latencyStat_t* send = &TPDO->latencySend;
+    const CO_TPDO_latencyStat_t* txc = &TPDO->latencyTxComplete;
+    uint8_t subIndex = stream->subIndex;
+    uint32_t value;
+
+    switch (subIndex) {
+        case 1: value = (uint32_t)latency->selected + 1U; break;
+        case 2: value = send->count; break;
+        case 3: value = (send->count > 0U) ? send->min_us : 0U; break;
+        case 4: value = send->max_us; break;
+        case 5: value = send->late; break;
+        case 6: value = txc->count; break;
+        case 7: value = (txc->count > 0U) ? txc->min_us : 0U; break;
+        case 8: value = txc->max_us; break;
+        case 9: value = txc->late; break;
+        default: {
+            uint32_t bin = (uint32_t)subIndex - CO_TPDO_LATENCY_OD_HIST;
+            if (bin < CO_TPDO_LATENCY_BINS) {
+                value = send->histogram[bin];
+            } else if (bin < (2U * CO_TPDO_LATENCY_BINS)) {
+                value = txc->histogram[bin - CO_TPDO_LATENCY_BINS];
+            } else {
+                return ODR_SUB_NOT_EXIST;
+            }
+            break;
+        }
+    }
+
+    (void)CO_setUint32(buf, value);
+    *countRead = sizeof(uint32_t);
+    return ODR_OK;
+}
+
+/*
+ * Custom function for writing OD record with TPDO latency statistics
+ *
+ * For more information see file CO_ODinterface.h, OD_IO_t.
+ */
+static ODR_t
+OD_write_TPDOlatency(OD_stream_t* stream, const void* buf, OD_size_t count, OD_size_t* countWritten) {
+    if ((stream == NULL) || (buf == NULL) || (count != sizeof(uint32_t)) || (countWritten == NULL)) {
+        return ODR_DEV_INCOMPAT;
+    }
+
+    CO_TPDO_latency_t* latency = (CO_TPDO_latency_t*)stream->object;
+    uint32_t value = CO_getUint32(buf);
+
+    if (stream->subIndex == 1U) {
+        if ((value == 0U) || (value > latency->TPDOcount)) {
+            return ODR_INVALID_VALUE;
+        }
+        latency->selected = (uint16_t)(value - 1U);
+    } else if (stream->subIndex == 2U) {
+        if (value != 0U) {
+            return ODR_INVALID_VALUE;
+        }
+        CO_TPDO_latencyReset(&latency->TPDOs[latency->selected]);
+    } else {
+        return ODR_READONLY;
+    }
+
+    *countWritten = sizeof(uint32_t);
+    return ODR_OK;
+}
+
+CO_ReturnError_t
+CO_TPDO_latencyInit(CO_TPDO_latency_t* latency, CO_TPDO_t* TPDOs, uint16_t count) {
+    if ((latency == NULL) || (TPDOs == NULL) || (count == 0U)) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
+
+    latency->TPDOs = TPDOs;
+    latency->TPDOcount = count;
+    latency->selected = 0;
+    latency->clock.syncValid = false;
+    CO_FLAG_CLEAR(latency->clock.syncStamped);
+
+    for (uint16_t i = 0; i < count; i++) {
+        TPDOs[i].latencyClock = &latency->clock;
+        CO_TPDO_latencyReset(&TPDOs[i]);
+    }
+
+    return CO_ERROR_NO;
+}
+
+void
+CO_TPDO_latencyInitClock(CO_TPDO_latency_t* latency, uint32_t (*getTime_us)(void* object), void* object) {
+    if (latency != NULL) {
+        latency->clock.getTime_us = getTime_us;
+        latency->clock.object = object;
+        latency->clock.syncValid = false;
+    }
+}
+
+CO_ReturnError_t
+CO_TPDO_latencyInitOD(CO_TPDO_latency_t* latency, OD_entry_t* OD_latency, uint32_t* errInfo) {
+    if ((latency == NULL) || (latency->TPDOs == NULL) || (OD_latency == NULL)) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
+
+    latency->OD_extension.object = latency;
+    latency->OD_extension.read = OD_read_TPDOlatency;
+    latency->OD_extension.write = OD_write_TPDOlatency;
+    if (OD_extension_init(OD_latency, &latency->OD_extension) != ODR_OK) {
+        if (errInfo != NULL) {
+            *errInfo = OD_getIndex(OD_latency);
+        }
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
+
+    return CO_ERROR_NO;
+}
+
+void
+CO_TPDO_latencyProcess(CO_TPDO_latency_t* latency, bool_t syncWas) {
+    if ((latency == NULL) || !syncWas || (latency->clock.getTime_us == NULL)) {
+        return;
+    }
+
+    /* Use timestamp from CO_TPDO_latencySync() or time of processing the SYNC. Take snapshot, so TPDOs of this SYNC
+     * are measured against it, even if next SYNC is stamped in the meantime. */
+    if (CO_FLAG_READ(latency->clock.syncStamped)) {
+        latency->clock.syncTime_us = latency->clock.syncStamp_us;
+        CO_FLAG_CLEAR(latency->clock.syncStamped);
+    } else {
+        latency->clock.syncTime_us = latency->clock.getTime_us(latency->clock.object);
+    }
+    latency->clock.syncValid = true;
+}
+
+void
+CO_TPDO_latencyTxComplete(CO_TPDO_t* TPDO, uint32_t timestamp_us) {
+    if ((TPDO != NULL) && CO_FLAG_READ(TPDO->latencyTxPending)) {
+        CO_FLAG_CLEAR(TPDO->latencyTxPending);
+        CO_TPDO_latencyAdd(&TPDO->latencyTxComplete, TPDO, timestamp_us - TPDO->latencySyncTime_us);
+    }
+}
+
+void
+CO_TPDO_latencyReset(CO_TPDO_t* TPDO) {
+    if (TPDO != NULL) {
+        CO_FLAG_CLEAR(TPDO->latencyTxPending);
+        (void)memset(&TPDO->latencySend, 0, sizeof(TPDO->latencySend));
+        (void)memset(&TPDO->latencyTxComplete, 0, sizeof(TPDO->latencyTxComplete));
+        TPDO->latencySend.min_us = 0xFFFFFFFFU;
+        TPDO->latencyTxComplete.min_us = 0xFFFFFFFFU;
+    }
+}
+#endif /* (CO_CONFIG_PDO) & CO_CONFIG_TPDO_LATENCY */
 #endif /* (CO_CONFIG_PDO) & CO_CONFIG_TPDO_ENABLE */
 #endif /* (CO_CONFIG_PDO) & (CO_CONFIG_RPDO_ENABLE | CO_CONFIG_TPDO_ENABLE) */
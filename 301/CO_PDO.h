@@ -57,7 +57,10 @@ extern "C" {
  *  - Data from OD variables are accessed via @ref OD_IO_t read()/write() functions, which gives a great usefulness to
  *    the application.
  *  - For systems with very low memory and processing capabilities there is a simplified @ref CO_CONFIG_PDO option,
- *    where instead of read()/write() access, PDO data are copied directly to/from memory locations of OD variables.
+ *    where instead of read()/write() access, PDO data are copied directly to/from memory locations of OD variables,
+ *    see @ref CO_PDO_directMap_t.
+ *  - With CO_CONFIG_PDO_COPY_PLAN mapping is compiled into a list of memcpy() runs, see @ref CO_PDO_copyRun_t, and
+ *    read()/write() access is used only for OD variables with IO extension.
  *  - After RPDO is received from CAN bus, its data are copied to internal buffer (inside fast CAN receive interrupt).
  *    Function CO_RPDO_process() (called by application) copies data to the mapped objects in the Object Dictionary.
  *    Synchronous RPDOs are processed AFTER reception of the next SYNC message.
@@ -65,6 +68,8 @@ extern "C" {
  *    types possible, controlled by: SYNC message, event timer, @ref CO_TPDOsendRequest() by application or @ref
  *    OD_requestTPDO(), where application can request TPDO for OD variable mapped to any of them. In later case
  *    application may, for example, monitor change of state of the OD variable and indicate TPDO request on it.
+ *  - With CO_CONFIG_TPDO_COS event driven TPDO can monitor change of state itself, see @ref CO_TPDO_setCOS().
+ *  - With CO_CONFIG_PDO_MPDO multiplexed PDOs are supported, see @ref CO_PDO_MPDO.
  *
  * @anchor CO_PDO_CAN_ID
  * ### CAN identifiers for PDO
@@ -101,6 +106,27 @@ extern "C" {
  * - Configure mapping
  * - Enable mapping by setting PDO mapping param, sub 0 to number of mapped objects
  * - Enable the PDO by setting bit-31 to 0 in PDO communication parameter, COB-ID
+ *
+ * @anchor CO_PDO_MPDO
+ * ### Multiplexed PDO
+ *
+ * MPDO is always 8 bytes long. Byte 0 contains address type (bit 7) and node-ID, bytes 1..3 contain index and
+ * sub-index, and bytes 4..7 contain data of single OD variable, up to four bytes long. PDO is configured as MPDO, if
+ * its mapping parameter, sub-index 0 is set to 0xFE (source address mode, SAM) or 0xFF (destination address mode, DAM),
+ * see @ref CO_PDO_mpdoMode_t. Communication parameters and transmission types are the same as for normal PDO.
+ *
+ * - DAM TPDO (typically master) transmits OD variable, mapped with sub-index 1 of the mapping parameter. Index and
+ *   sub-index of that variable are used as multiplexer, node-ID is set by @ref CO_TPDO_setMPDOdestination().
+ * - DAM RPDO writes data into own OD variable, specified by multiplexer, if node-ID matches or is zero.
+ * - SAM TPDO transmits OD variables from own object scanner list (0x1FA0+), one variable with each transmission. In
+ *   event driven TPDO request (or event timer) transmits all variables from the scanner list, paced by inhibit time.
+ *   See @ref CO_TPDO_initMPDO().
+ * - SAM RPDO writes data into OD variable, which is found by node-ID of the producer and multiplexer in the object
+ *   dispatching list (0x1FD0+). Dispatching lists are compiled into hash table for lookup in constant time, see
+ *   @ref CO_MPDO_dispatcher_init().
+ *
+ * MPDOs are received into the same buffer as other RPDOs, so they must not be received faster than @ref
+ * CO_RPDO_process() is called.
  */
 
 /** Maximum size of PDO message, 8 for standard CAN */
@@ -146,6 +172,102 @@ typedef enum {
                                                  specific) */
 } CO_PDO_transmissionTypes_t;
 
+#if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_MPDO) != 0) || defined CO_DOXYGEN
+/**
+ * Values of PDO mapping parameter, sub-index 0, which configure PDO as MPDO, see @ref CO_PDO_MPDO
+ */
+typedef enum {
+    CO_PDO_MPDO_SAM = 0xFEU, /**< source address mode */
+    CO_PDO_MPDO_DAM = 0xFFU  /**< destination address mode */
+} CO_PDO_mpdoMode_t;
+#endif
+
+#if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_COPY_PLAN) != 0) && (((CO_CONFIG_PDO)&CO_CONFIG_PDO_BITWISE_MAPPING) != 0)
+/**
+ * One entry of the PDO copy plan for bitwise mapping
+ *
+ * Each mapped entry has own run. Shift and mask are calculated from mapping, so each entry is packed into or unpacked
+ * from 64-bit PDO data with single shift and mask. Value of OD variable is copied into uint64_t at valueOffset, which
+ * is zero on little endian and (8 - length) on big endian targets.
+ */
+typedef struct {
+    uint64_t mask;       /**< Mask for mapped bits, zero if no bits are mapped */
+    uint8_t* dataOD;     /**< Pointer to data in the original OD location or NULL, if OD_IO[mapIndex] is used */
+    uint8_t shift;       /**< Bit offset of the entry inside PDO data */
+    uint8_t bits;        /**< Number of mapped bits */
+    uint8_t length;      /**< Number of bytes copied from or to OD variable */
+    uint8_t valueOffset; /**< Byte offset of OD data inside uint64_t value */
+    uint8_t mapIndex;    /**< Index of the mapped entry */
+} CO_PDO_copyRun_t;
+#elif (((CO_CONFIG_PDO)&CO_CONFIG_PDO_COPY_PLAN) != 0) || defined CO_DOXYGEN
+/**
+ * One run of the PDO copy plan
+ *
+ * Copy plan is compiled from PDO mapping, when mapping is enabled. Mapped OD variables without IO extension, whose
+ * mapped length equals to their size, are copied directly between PDO data and original OD location. Variables, which
+ * are adjacent in PDO and in OD memory, are merged into single run, copied with single memcpy(). Other mapped entries
+ * (IO extension, dummy entries, partially mapped variables) get own run with OD_IO read()/write() access.
+ */
+typedef struct {
+    uint8_t* dataOD;  /**< Pointer to data in the original OD location or NULL, if OD_IO[mapIndex] is used */
+    uint8_t offset;   /**< Byte offset of the run inside PDO data */
+    uint8_t length;   /**< Number of bytes in the run */
+    uint8_t mapIndex; /**< Index of the first mapped entry in the run */
+#if defined CO_BIG_ENDIAN || defined CO_DOXYGEN
+    bool_t swap; /**< True, if run is single multi-byte variable, which must be byte swapped */
+#endif
+} CO_PDO_copyRun_t;
+#endif
+
+#if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_OD_IO_ACCESS) == 0) || defined CO_DOXYGEN
+/**
+ * Directly accessed mapped entry of the PDO
+ *
+ * Used without CO_CONFIG_PDO_OD_IO_ACCESS. Each mapped entry is copied between PDO data and original OD location
+ * (CO_PDO_common_t.directDataOD) with single memcpy(). Dummy entries point to internal buffer. With
+ * CO_CONFIG_PDO_BITWISE_MAPPING value of OD variable is copied into uint64_t (at the end of it on big endian) and mapped
+ * bits are packed into or unpacked from 64-bit PDO data. Pointers are kept in separate array, so this structure has
+ * two bytes, without padding.
+ */
+typedef struct {
+    uint8_t length; /**< Number of bytes copied from or to OD variable */
+#if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_BITWISE_MAPPING) != 0) || defined CO_DOXYGEN
+    uint8_t bits; /**< Number of mapped bits */
+#elif defined CO_BIG_ENDIAN || defined CO_DOXYGEN
+    uint8_t swap; /**< Non-zero, if entry is multi-byte variable, which must be byte swapped */
+#endif
+} CO_PDO_directMap_t;
+#endif
+
+#if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_COLD_SPLIT) != 0) || defined CO_DOXYGEN
+/**
+ * Data of the PDO, which is not needed for processing of idle PDO, separated from @ref CO_PDO_common_t.
+ *
+ * Used with CO_CONFIG_PDO_COLD_SPLIT. Dynamic configuration data is accessed only, when PDO is configured. OD_IO[] is
+ * accessed on configuration and also on each received RPDO, which is copied to OD variables, and on each transmitted
+ * TPDO, which is read from OD variables. Processing cycle, in which PDO does not receive or transmit, does not access
+ * this data. Array of objects is defined by application, separately from RPDO and TPDO objects. So arrays of RPDO and
+ * TPDO objects stay compact, which is important with many PDOs. Members are the same as in CO_PDO_common_t without
+ * CO_CONFIG_PDO_COLD_SPLIT.
+ */
+typedef struct {
+    OD_IO_t OD_IO[CO_PDO_MAX_MAPPED_ENTRIES]; /**< Object dictionary interface for all mapped entries */
+#if (((CO_CONFIG_PDO)&CO_CONFIG_FLAG_OD_DYNAMIC) != 0) || defined CO_DOXYGEN
+    bool_t isRPDO;                            /**< True for RPDO, false for TPDO */
+    OD_t* OD;                                 /**< From CO_xPDO_init() */
+    uint16_t CANdevIdx;                       /**< From CO_xPDO_init() */
+    uint16_t preDefinedCanId;                 /**< From CO_xPDO_init() */
+    uint16_t configuredCanId;                 /**< Currently configured CAN identifier */
+    OD_extension_t OD_communicationParam_ext; /**< Extension for OD object */
+    OD_extension_t OD_mappingParam_extension; /**< Extension for OD object */
+#endif
+#if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_STAGED_MAPPING) != 0) || defined CO_DOXYGEN
+    OD_entry_t* OD_communicationParam; /**< From CO_xPDO_init(), used by staged mapping */
+    OD_entry_t* OD_mappingParam;       /**< From CO_xPDO_init(), used by staged mapping */
+#endif
+} CO_PDO_cold_t;
+#endif
+
 /**
  * PDO object, common properties
  */
@@ -155,7 +277,14 @@ typedef struct {
     bool_t valid;               /**< True, if PDO is enabled and valid */
     CO_PDO_size_t dataLength;   /**< Data length of the received PDO message. Calculated from mapping */
     uint8_t mappedObjectsCount; /**< Number of mapped objects in PDO */
+#if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_MPDO) != 0) || defined CO_DOXYGEN
+    uint8_t mpdoMode; /**< Value from @ref CO_PDO_mpdoMode_t for MPDO or 0 otherwise */
+#endif
+#if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_COLD_SPLIT) != 0) || defined CO_DOXYGEN
+    CO_PDO_cold_t* cold; /**< Data not needed by idle PDO, from CO_xPDO_init() */
+#endif
 #if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_OD_IO_ACCESS) != 0) || defined CO_DOXYGEN
+#if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_COLD_SPLIT) == 0) || defined CO_DOXYGEN
     OD_IO_t OD_IO[CO_PDO_MAX_MAPPED_ENTRIES]; /**< Object dictionary interface for all mapped entries. OD_IO.dataOffset
                                                  has special usage with PDO. It stores information about the number of bytes
                                                  mapped to the PDO. If CO_CONFIG_PDO_BITWISE_MAPPING is enabled, it stores a
@@ -167,20 +296,23 @@ typedef struct {
                                                  function call and after the call OD_IO.dataOffset is set back to
                                                  mappedLength (if CO_CONFIG_PDO_BITWISE_MAPPING is disabled) or
                                                  mappedLengthBits (if CO_CONFIG_PDO_BITWISE_MAPPING is enabled). */
+#endif
+#if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_COPY_PLAN) != 0) || defined CO_DOXYGEN
+    CO_PDO_copyRun_t copyRun[CO_PDO_MAX_MAPPED_ENTRIES]; /**< Copy plan, compiled from mapping */
+    uint8_t copyRunsCount;                               /**< Number of runs in copyRun */
+#endif
+#endif
+#if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_OD_IO_ACCESS) == 0) || defined CO_DOXYGEN
+    uint8_t* directDataOD[CO_PDO_MAX_MAPPED_ENTRIES];         /**< Original OD locations of mapped entries */
+    CO_PDO_directMap_t directMap[CO_PDO_MAX_MAPPED_ENTRIES]; /**< Mapped entries, accessed directly */
+#endif
 #if OD_FLAGS_PDO_SIZE > 0
     uint8_t* flagPDObyte[CO_PDO_MAX_MAPPED_ENTRIES];   /**< Pointer to byte, which contains PDO flag bit from @ref
                                                           OD_extension_t */
     uint8_t flagPDObitmask[CO_PDO_MAX_MAPPED_ENTRIES]; /**< Bitmask for the flagPDObyte */
 #endif
-#else
-    /* Pointers to data objects inside OD, where PDO will be copied */
-    uint8_t* mapPointer[CO_PDO_MAX_SIZE];
-#if OD_FLAGS_PDO_SIZE > 0
-    uint8_t* flagPDObyte[CO_PDO_MAX_SIZE];
-    uint8_t flagPDObitmask[CO_PDO_MAX_SIZE];
-#endif
-#endif
-#if (((CO_CONFIG_PDO)&CO_CONFIG_FLAG_OD_DYNAMIC) != 0) || defined CO_DOXYGEN
+#if ((((CO_CONFIG_PDO)&CO_CONFIG_FLAG_OD_DYNAMIC) != 0) && (((CO_CONFIG_PDO)&CO_CONFIG_PDO_COLD_SPLIT) == 0))    \
+    || defined CO_DOXYGEN
     bool_t isRPDO;                            /**< True for RPDO, false for TPDO */
     OD_t* OD;                                 /**< From CO_xPDO_init() */
     uint16_t CANdevIdx;                       /**< From CO_xPDO_init() */
@@ -189,8 +321,33 @@ typedef struct {
     OD_extension_t OD_communicationParam_ext; /**< Extension for OD object */
     OD_extension_t OD_mappingParam_extension; /**< Extension for OD object */
 #endif
+#if ((((CO_CONFIG_PDO)&CO_CONFIG_PDO_STAGED_MAPPING) != 0) && (((CO_CONFIG_PDO)&CO_CONFIG_PDO_COLD_SPLIT) == 0))  \
+    || defined CO_DOXYGEN
+    OD_entry_t* OD_communicationParam; /**< From CO_xPDO_init(), used by staged mapping */
+    OD_entry_t* OD_mappingParam;       /**< From CO_xPDO_init(), used by staged mapping */
+#endif
 } CO_PDO_common_t;
 
+#if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_STAGED_MAPPING) != 0) || defined CO_DOXYGEN
+/**
+ * Staged PDO mapping, see @ref CO_RPDO_stageMapping() and @ref CO_TPDO_stageMapping().
+ *
+ * New mapping is verified and compiled into shadow PDO in advance. Processing function swaps it into the PDO at SYNC
+ * (synchronous PDO) or at next call (event driven PDO) and writes new values into mapping and communication parameter
+ * in Object Dictionary. PDO stays enabled, so there is no gap in communication and no frame with partially changed
+ * mapping. Object is defined by application and must exist until swap.
+ */
+typedef struct {
+    CO_PDO_common_t shadow;                 /**< PDO with new mapping, not used by PDO processing until swap */
+    uint32_t map[CO_PDO_MAX_MAPPED_ENTRIES]; /**< New values of mapping parameter, sub-indexes 1... */
+    uint8_t mappedObjectsCount;             /**< New value of mapping parameter, sub-index 0 */
+    uint16_t CAN_ID;                        /**< New CAN identifier or 0, if unchanged */
+#if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_COLD_SPLIT) != 0) || defined CO_DOXYGEN
+    CO_PDO_cold_t shadowCold;               /**< Cold data of the shadow PDO */
+#endif
+} CO_PDO_stagedMap_t;
+#endif
+
 /*******************************************************************************
  *      R P D O
  ******************************************************************************/
@@ -204,6 +361,88 @@ typedef struct {
 #define CO_RPDO_CAN_BUFFERS_COUNT 1
 #endif
 
+#if (((CO_CONFIG_PDO)&CO_CONFIG_RPDO_RX_QUEUE) != 0) || defined CO_DOXYGEN
+/**
+ * Processing mode of RPDO receive queue, see @ref CO_RPDO_initRxQueue().
+ */
+typedef enum {
+    CO_RPDO_RXQ_ALL = 0U,   /**< All received RPDOs from the queue are written into OD variables in received order */
+    CO_RPDO_RXQ_LATEST = 1U /**< Only latest received RPDO from the queue is written into OD variables, older are
+                               skipped */
+} CO_RPDO_rxQueueMode_t;
+#endif
+
+#if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_MPDO) != 0) || defined CO_DOXYGEN
+/**
+ * One slot of the MPDO dispatcher hash table
+ */
+typedef struct {
+    uint32_t key;      /**< Producer node-ID (bits 24..31), index (bits 8..23) and sub-index (bits 0..7) in the
+                          producer, 0 for empty slot */
+    OD_entry_t* entry; /**< Local OD entry */
+    uint8_t subIndex;  /**< Local sub-index */
+} CO_MPDO_dispatchSlot_t;
+
+/**
+ * MPDO dispatcher, object dispatching list for SAM RPDOs compiled into hash table
+ */
+typedef struct {
+    CO_MPDO_dispatchSlot_t* slots; /**< From CO_MPDO_dispatcher_init() */
+    uint16_t slotsCount;           /**< From CO_MPDO_dispatcher_init() */
+    uint16_t slotsUsed;            /**< Number of used slots */
+    uint8_t slotsBits;             /**< slotsCount = 2^slotsBits */
+} CO_MPDO_dispatcher_t;
+
+/**
+ * Initialize MPDO dispatcher.
+ *
+ * Function reads all object dispatching lists (OD objects 0x1FD0 to 0x1FFF) and fills the hash table with their
+ * entries. Each entry with block size N occupies N slots. Lists are read once, in the communication reset section,
+ * changes of the lists are applied on next initialization. Same dispatcher may be used by multiple SAM RPDOs.
+ *
+ * @param dispatcher This object will be initialized.
+ * @param OD Object Dictionary.
+ * @param slots Array of hash table slots, defined by application. It must exist permanently.
+ * @param slotsCount Number of slots, must be power of two and larger than number of dispatched objects.
+ * @param [out] errInfo Index and sub-index of erroneous dispatching list entry in case of error, may be NULL.
+ *
+ * @return #CO_ReturnError_t CO_ERROR_NO, CO_ERROR_ILLEGAL_ARGUMENT, CO_ERROR_OD_PARAMETERS (local object from
+ * dispatching list does not exist) or CO_ERROR_OUT_OF_MEMORY (hash table is too small).
+ */
+CO_ReturnError_t CO_MPDO_dispatcher_init(CO_MPDO_dispatcher_t* dispatcher, OD_t* OD, CO_MPDO_dispatchSlot_t* slots,
+                                         uint16_t slotsCount, uint32_t* errInfo);
+#endif /* (CO_CONFIG_PDO) & CO_CONFIG_PDO_MPDO */
+
+#if (((CO_CONFIG_PDO)&CO_CONFIG_RPDO_READY_LIST) != 0) || defined CO_DOXYGEN
+/**
+ * List of RPDOs with new data, see @ref CO_RPDO_readyList_init().
+ *
+ * Queue is lock-free, with single producer (@ref CO_PDO_receive(), CAN receive interrupt) and single consumer
+ * (@ref CO_RPDO_processReadyList()). It contains indexes of RPDOs. Each RPDO is inside queue at most once, so queue,
+ * which is one element larger than number of RPDOs, can not overflow.
+ */
+typedef struct {
+    uint16_t* queue;          /**< Indexes of RPDOs with new data, from CO_RPDO_readyList_init() */
+    uint16_t queueSize;       /**< Number of RPDOs + 1 */
+    volatile uint16_t head;   /**< Position of next element written by CO_PDO_receive() */
+    uint16_t tail;            /**< Position of next element read by CO_RPDO_processReadyList() */
+    volatile void* CANrxNew;  /**< Set after new element is written into queue, cleared before queue is read. Flag
+                                 macros also act as memory barriers between queue and head */
+    uint16_t* syncPending;    /**< Indexes of synchronous RPDOs, which wait for SYNC, from CO_RPDO_readyList_init() */
+    uint16_t syncPendingCount; /**< Number of elements in syncPending */
+#if (((CO_CONFIG_PDO)&CO_CONFIG_RPDO_TIMERS_ENABLE) != 0) || defined CO_DOXYGEN
+    uint32_t time_us;         /**< Time since CO_RPDO_readyList_init() in microseconds, it may overflow */
+    uint32_t nextDeadline_us; /**< Earliest timeout deadline of all monitored RPDOs, valid if deadlineArmed */
+    bool_t deadlineArmed;     /**< True, if any RPDO is monitored for timeout */
+    uint16_t timedOutCount;   /**< Number of RPDOs in timeout */
+#endif
+    bool_t NMTwasOperational; /**< NMT operational state from previous call */
+#if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_STAGED_MAPPING) != 0) || defined CO_DOXYGEN
+    bool_t stagedPending;     /**< True, if any RPDO has staged mapping, set by CO_RPDO_stageMapping() */
+#endif
+} CO_RPDO_readyList_t;
+#endif /* (CO_CONFIG_PDO) & CO_CONFIG_RPDO_READY_LIST */
+
 /**
  * RPDO object.
  */
@@ -213,6 +452,16 @@ typedef struct {
     uint8_t CANrxData[CO_RPDO_CAN_BUFFERS_COUNT][CO_PDO_MAX_SIZE]; /**< CO_PDO_MAX_SIZE data bytes of the received
                                                                       message. */
     uint8_t receiveError; /**< Indication of RPDO length errors, use with CO_PDO_receiveErrors_t */
+#if (((CO_CONFIG_PDO)&CO_CONFIG_RPDO_RX_QUEUE) != 0) || defined CO_DOXYGEN
+    uint8_t (*rxQueue)[CO_PDO_MAX_SIZE]; /**< From CO_RPDO_initRxQueue() or NULL */
+    uint16_t rxQueueSize;                /**< From CO_RPDO_initRxQueue() */
+    volatile uint16_t rxQueueHead;       /**< Position of next RPDO written by CO_PDO_receive() */
+    volatile uint16_t rxQueueTail;       /**< Position of next RPDO read by CO_RPDO_process() */
+    uint8_t rxQueueMode;                 /**< From CO_RPDO_initRxQueue(), use with CO_RPDO_rxQueueMode_t */
+    uint32_t rxOverrun; /**< Number of received RPDOs, which were lost, because receive queue was full or, without
+                           queue, because previous RPDO was not processed yet. Incremented by CO_PDO_receive(), may be
+                           read or cleared by application. */
+#endif
 #if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_SYNC_ENABLE) != 0) || defined CO_DOXYGEN
     CO_SYNC_t* SYNC;    /**< From CO_RPDO_init() */
     bool_t synchronous; /**< True if transmissionType <= 240 */
@@ -226,6 +475,26 @@ typedef struct {
     void (*pFunctSignalPre)(void* object); /**< From CO_RPDO_initCallbackPre() or NULL */
     void* functSignalObjectPre;            /**< From CO_RPDO_initCallbackPre() or NULL */
 #endif
+#if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_MPDO) != 0) || defined CO_DOXYGEN
+    OD_t* mpdoOD;                               /**< From CO_RPDO_initMPDO() */
+    const CO_MPDO_dispatcher_t* mpdoDispatcher; /**< From CO_RPDO_initMPDO() */
+    uint8_t mpdoNodeId;                         /**< From CO_RPDO_initMPDO() */
+    bool_t mpdoError;                           /**< True, if last received MPDO could not be written */
+#endif
+#if (((CO_CONFIG_PDO)&CO_CONFIG_RPDO_READY_LIST) != 0) || defined CO_DOXYGEN
+    CO_RPDO_readyList_t* readyList; /**< From CO_RPDO_readyList_init() or NULL */
+    volatile void* readyQueued;     /**< Set, if RPDO is inside readyList queue */
+    uint16_t readyIndex;            /**< Index of this RPDO, from CO_RPDO_readyList_init() */
+    bool_t readySyncPending;        /**< True, if RPDO is inside readyList syncPending */
+#if (((CO_CONFIG_PDO)&CO_CONFIG_RPDO_TIMERS_ENABLE) != 0) || defined CO_DOXYGEN
+    uint32_t timeoutDeadline_us;    /**< Time of timeout in readyList time base. With ready list timeoutTimer is
+                                       0 if RPDO is not monitored, otherwise non-zero. */
+    bool_t readyTimedOut;           /**< True, if RPDO is in timeout */
+#endif
+#endif
+#if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_STAGED_MAPPING) != 0) || defined CO_DOXYGEN
+    CO_PDO_stagedMap_t* stagedMap; /**< From CO_RPDO_stageMapping(), NULL if no mapping is staged */
+#endif
 } CO_RPDO_t;
 
 /**
@@ -238,6 +507,7 @@ typedef struct {
  * @param OD Object Dictionary.
  * @param em Emergency object.
  * @param SYNC SYNC object, may be NULL.
+ * @param cold Object for cold data, if CO_CONFIG_PDO_COLD_SPLIT is enabled, see @ref CO_PDO_cold_t.
  * @param preDefinedCanId CAN identifier from pre-defined connection set, including node-id for first four PDOs, or 0
  * otherwise, see @ref CO_PDO_CAN_ID
  * @param OD_14xx_RPDOCommPar OD entry for 0x1400+ - "RPDO communication parameter", entry is required.
@@ -251,6 +521,9 @@ typedef struct {
 CO_ReturnError_t CO_RPDO_init(CO_RPDO_t* RPDO, OD_t* OD, CO_EM_t* em,
 #if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_SYNC_ENABLE) != 0) || defined CO_DOXYGEN
                               CO_SYNC_t* SYNC,
+#endif
+#if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_COLD_SPLIT) != 0) || defined CO_DOXYGEN
+                              CO_PDO_cold_t* cold,
 #endif
                               uint16_t preDefinedCanId, OD_entry_t* OD_14xx_RPDOCommPar, OD_entry_t* OD_16xx_RPDOMapPar,
                               CO_CANmodule_t* CANdevRx, uint16_t CANdevRxIdx, uint32_t* errInfo);
@@ -269,6 +542,45 @@ CO_ReturnError_t CO_RPDO_init(CO_RPDO_t* RPDO, OD_t* OD, CO_EM_t* em,
 void CO_RPDO_initCallbackPre(CO_RPDO_t* RPDO, void* object, void (*pFunctSignalPre)(void* object));
 #endif
 
+#if (((CO_CONFIG_PDO)&CO_CONFIG_RPDO_RX_QUEUE) != 0) || defined CO_DOXYGEN
+/**
+ * Initialize receive queue of RPDO.
+ *
+ * Function must be called after @ref CO_RPDO_init(). By default RPDO has a single receive buffer for asynchronous
+ * RPDO. If new RPDO is received before previous is processed, previous is lost. With receive queue all RPDOs received
+ * between two calls of CO_RPDO_process() are stored and processed according to mode. Queue is single producer, single
+ * consumer and lock-free. If queue is full, newly received RPDO is lost and rxOverrun is incremented.
+ *
+ * Queue is used only for asynchronous RPDOs (transmission type 254 or 255). Synchronous RPDOs use the buffers
+ * selected by SYNC.
+ *
+ * @param RPDO This object.
+ * @param queue Array of queueSize RPDO data buffers, defined by application. It must exist permanently. If NULL,
+ * queue is disabled.
+ * @param queueSize Number of buffers in the queue. Queue holds up to (queueSize - 1) RPDOs, must be at least 2.
+ * @param mode Processing mode, see @ref CO_RPDO_rxQueueMode_t.
+ *
+ * @return #CO_ReturnError_t CO_ERROR_NO or CO_ERROR_ILLEGAL_ARGUMENT.
+ */
+CO_ReturnError_t CO_RPDO_initRxQueue(CO_RPDO_t* RPDO, uint8_t (*queue)[CO_PDO_MAX_SIZE], uint16_t queueSize,
+                                     CO_RPDO_rxQueueMode_t mode);
+#endif
+
+#if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_MPDO) != 0) || defined CO_DOXYGEN
+/**
+ * Initialize reception of MPDO.
+ *
+ * Function must be called after @ref CO_RPDO_init(). It is necessary, if RPDO is configured as MPDO, otherwise
+ * received MPDOs are ignored. See @ref CO_PDO_MPDO.
+ *
+ * @param RPDO This object.
+ * @param OD Object Dictionary, used for DAM MPDO.
+ * @param nodeId Own node-ID, used for DAM MPDO.
+ * @param dispatcher Initialized MPDO dispatcher, used for SAM MPDO, may be NULL.
+ */
+void CO_RPDO_initMPDO(CO_RPDO_t* RPDO, OD_t* OD, uint8_t nodeId, const CO_MPDO_dispatcher_t* dispatcher);
+#endif
+
 /**
  * Process received PDO messages.
  *
@@ -290,12 +602,138 @@ void CO_RPDO_process(CO_RPDO_t* RPDO,
                      uint32_t timeDifference_us, bool_t* timeoutState, uint32_t* timerNext_us,
 #endif
                      bool_t NMTisOperational, bool_t syncWas);
+
+#if (((CO_CONFIG_PDO)&CO_CONFIG_RPDO_READY_LIST) != 0) || defined CO_DOXYGEN
+/**
+ * Initialize list of RPDOs with new data.
+ *
+ * Function must be called after @ref CO_RPDO_init() of all RPDOs. After that @ref CO_PDO_receive() puts each RPDO,
+ * which received new data, into the list. All RPDOs must be received by the same CAN receive context.
+ *
+ * @param readyList This object will be initialized.
+ * @param RPDOs Array of initialized RPDO objects.
+ * @param RPDOcount Number of RPDO objects in the array.
+ * @param queue Array of (RPDOcount + 1) elements, defined by application. It must exist permanently.
+ * @param syncPending Array of RPDOcount elements, defined by application. It must exist permanently.
+ *
+ * @return #CO_ReturnError_t CO_ERROR_NO or CO_ERROR_ILLEGAL_ARGUMENT.
+ */
+CO_ReturnError_t CO_RPDO_readyList_init(CO_RPDO_readyList_t* readyList, CO_RPDO_t* RPDOs, uint16_t RPDOcount,
+                                        uint16_t* queue, uint16_t* syncPending);
+
+/**
+ * Process RPDOs from the list of RPDOs with new data.
+ *
+ * Function is used instead of calling @ref CO_RPDO_process() for each RPDO. It must be called cyclically in any NMT
+ * state. Only RPDOs from the ready list are processed, synchronous RPDOs are kept in the list until next SYNC.
+ *
+ * RPDO timeout is monitored by deadlines. Each received RPDO with event timer sets its deadline. All RPDOs are
+ * checked only when the earliest deadline expires or when NMT operational state is left. So processing time depends
+ * on number of received RPDOs and not on number of configured RPDOs.
+ *
+ * @param readyList This object.
+ * @param RPDOs Array of RPDO objects, same as in CO_RPDO_readyList_init().
+ * @param timeDifference_us Time difference from previous function call.
+ * @param [out] timeoutState Set to true, if any RPDO is in timeout. If it remains false, CO_errorReset should be
+ * called. Can be NULL if not needed.
+ * @param [out] timerNext_us info to OS - see CO_process().
+ * @param NMTisOperational True if this node is in NMT_OPERATIONAL state.
+ * @param syncWas True, if CANopen SYNC message was just received or transmitted.
+ */
+void CO_RPDO_processReadyList(CO_RPDO_readyList_t* readyList, CO_RPDO_t* RPDOs,
+#if (((CO_CONFIG_PDO)&CO_CONFIG_RPDO_TIMERS_ENABLE) != 0) || defined CO_DOXYGEN
+                              uint32_t timeDifference_us, bool_t* timeoutState, uint32_t* timerNext_us,
+#endif
+                              bool_t NMTisOperational, bool_t syncWas);
+#endif /* (CO_CONFIG_PDO) & CO_CONFIG_RPDO_READY_LIST */
+
+#if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_STAGED_MAPPING) != 0) || defined CO_DOXYGEN
+/**
+ * Stage new mapping and CAN-ID of RPDO, see @ref CO_PDO_stagedMap_t.
+ *
+ * Mapping is verified and prepared in stagedMap, RPDO continues to work with the current mapping. New mapping is
+ * swapped in by @ref CO_RPDO_process() or @ref CO_RPDO_processReadyList(). Synchronous RPDO swaps after data from
+ * the SYNC, at which it was received, is written to Object Dictionary. Event driven RPDO swaps at next call. Disabled
+ * RPDO or RPDO outside NMT operational state swaps at next call. Until swap, length of received frames is verified
+ * against the current mapping.
+ *
+ * Function must be called from the same thread as processing function or with @ref CO_LOCK_OD locked.
+ *
+ * @param RPDO This object.
+ * @param stagedMap Object, defined by application, it must exist until swap.
+ * @param map Array of mappedObjectsCount new values of mapping parameter, sub-indexes 1...
+ * @param mappedObjectsCount Number of mapped objects, from 1 to CO_PDO_MAX_MAPPED_ENTRIES. MPDO can not be staged.
+ * @param CAN_ID New CAN identifier or 0, if it is not changed. It is written to communication parameter, sub-index 1.
+ *
+ * @return ODR_OK on success, ODR_DATA_DEV_STATE if previous mapping is not swapped yet, ODR_INVALID_VALUE for wrong
+ * CAN_ID or mappedObjectsCount, ODR_MAP_LEN if mapping is too long, or other error of the mapped entry.
+ */
+ODR_t CO_RPDO_stageMapping(CO_RPDO_t* RPDO, CO_PDO_stagedMap_t* stagedMap, const uint32_t* map,
+                           uint8_t mappedObjectsCount, uint16_t CAN_ID);
+#endif
 #endif /* (CO_CONFIG_PDO) & CO_CONFIG_RPDO_ENABLE */
 
 /*******************************************************************************
  *      T P D O
  ******************************************************************************/
 #if (((CO_CONFIG_PDO)&CO_CONFIG_TPDO_ENABLE) != 0) || defined CO_DOXYGEN
+#if (((CO_CONFIG_PDO)&CO_CONFIG_TPDO_COS) != 0) || defined CO_DOXYGEN
+/**
+ * Change of value (COS) mode of event driven TPDO, see @ref CO_TPDO_setCOS().
+ */
+typedef enum {
+    CO_TPDO_COS_OFF = 0U,      /**< COS disabled, TPDO is sent on request or event timer only */
+    CO_TPDO_COS_PAYLOAD = 1U,  /**< TPDO is sent, if any bit of its data differs from last transmitted TPDO */
+    CO_TPDO_COS_DEADBAND = 2U  /**< TPDO is sent, if any mapped entry differs from its last transmitted value for
+                                  more than its deadband, see @ref CO_TPDO_setDeadband() */
+} CO_TPDO_cosMode_t;
+
+/**
+ * Flags for deadband of mapped entry, see @ref CO_TPDO_setDeadband().
+ */
+typedef enum {
+    CO_TPDO_COS_SIGNED = 0x01U,  /**< Mapped entry is signed integer (two's complement), unsigned otherwise */
+    CO_TPDO_COS_RELATIVE = 0x02U /**< Deadband is relative, in 1/1000 of the last transmitted value, absolute
+                                    otherwise */
+} CO_TPDO_cosFlags_t;
+#endif /* (CO_CONFIG_PDO) & CO_CONFIG_TPDO_COS */
+
+#if (((CO_CONFIG_PDO)&CO_CONFIG_TPDO_LATENCY) != 0) || defined CO_DOXYGEN
+/** Number of histogram bins of synchronous TPDO latency, see @ref CO_TPDO_latencyStat_t */
+#ifndef CO_TPDO_LATENCY_BINS
+#define CO_TPDO_LATENCY_BINS 8U
+#endif
+
+/** Width of one histogram bin of synchronous TPDO latency in microseconds */
+#ifndef CO_TPDO_LATENCY_BIN_US
+#define CO_TPDO_LATENCY_BIN_US 100U
+#endif
+
+/**
+ * Latency statistics of synchronous TPDO, time from SYNC to the measured event, see @ref CO_TPDO_latency_t.
+ */
+typedef struct {
+    uint32_t count;  /**< Number of samples */
+    uint32_t min_us; /**< Minimum latency in microseconds, 0xFFFFFFFF if there are no samples */
+    uint32_t max_us; /**< Maximum latency in microseconds */
+    uint32_t late;   /**< Number of samples, which were outside synchronous window length (OD 0x1007) */
+    uint32_t histogram[CO_TPDO_LATENCY_BINS]; /**< Number of samples inside each CO_TPDO_LATENCY_BIN_US wide bin.
+                                                 The last bin contains also all larger latencies. */
+} CO_TPDO_latencyStat_t;
+
+/**
+ * Time source and time of the last SYNC for synchronous TPDO latency, part of @ref CO_TPDO_latency_t.
+ */
+typedef struct {
+    uint32_t (*getTime_us)(void* object); /**< From CO_TPDO_latencyInitClock() or NULL */
+    void* object;                         /**< From CO_TPDO_latencyInitClock() */
+    volatile uint32_t syncStamp_us;       /**< Timestamp of the last SYNC from CO_TPDO_latencySync() */
+    volatile void* syncStamped;           /**< Flag set by CO_TPDO_latencySync(), cleared by CO_TPDO_latencyProcess() */
+    uint32_t syncTime_us;                 /**< Timestamp of the last processed SYNC, from CO_TPDO_latencyProcess() */
+    bool_t syncValid;                     /**< True, if syncTime_us is known */
+} CO_TPDO_latencyClock_t;
+#endif /* (CO_CONFIG_PDO) & CO_CONFIG_TPDO_LATENCY */
+
 /**
  * TPDO object.
  */
@@ -310,12 +748,41 @@ typedef struct {
     uint8_t syncStartValue; /**< Copy of the variable from object dictionary */
     uint8_t syncCounter;    /**< SYNC counter used for PDO sending */
 #endif
+#if (((CO_CONFIG_PDO)&CO_CONFIG_TPDO_SYNC_BALANCE) != 0) || defined CO_DOXYGEN
+    uint8_t syncPhase; /**< Phase of cyclic synchronous TPDO from CO_TPDO_balanceSync() or CO_PDO_SYNC_PHASE_AUTO */
+#endif
+#if (((CO_CONFIG_PDO)&CO_CONFIG_TPDO_LATENCY) != 0) || defined CO_DOXYGEN
+    CO_TPDO_latencyClock_t* latencyClock;   /**< From CO_TPDO_latencyInit() or NULL */
+    uint32_t latencySyncTime_us;            /**< Timestamp of SYNC, to which the last sent TPDO belongs */
+    volatile void* latencyTxPending;        /**< Flag set, when TPDO is sent, cleared by CO_TPDO_latencyTxComplete() */
+    CO_TPDO_latencyStat_t latencySend;      /**< Latency from SYNC to CO_CANsend() */
+    CO_TPDO_latencyStat_t latencyTxComplete; /**< Latency from SYNC to transmission complete */
+#endif
 #if (((CO_CONFIG_PDO)&CO_CONFIG_TPDO_TIMERS_ENABLE) != 0) || defined CO_DOXYGEN
     uint32_t inhibitTime_us; /**< Inhibit time from object dictionary translated to microseconds */
     uint32_t eventTime_us;   /**< Event time from object dictionary translated to microseconds */
     uint32_t inhibitTimer;   /**< Inhibit timer variable in microseconds */
     uint32_t eventTimer;     /**< Event timer variable in microseconds */
 #endif
+#if (((CO_CONFIG_PDO)&CO_CONFIG_TPDO_COS) != 0) || defined CO_DOXYGEN
+    uint8_t cosMode;                                 /**< Value from @ref CO_TPDO_cosMode_t */
+    uint32_t cosCheckTime_us;                        /**< Period of COS checks, from CO_TPDO_setCOS() */
+    uint32_t cosTimer;                               /**< Time to the next COS check in microseconds */
+    uint8_t cosData[CO_PDO_MAX_SIZE];                /**< Data of the last transmitted TPDO */
+    uint8_t cosFlags[CO_PDO_MAX_MAPPED_ENTRIES];     /**< Deadband flags from @ref CO_TPDO_cosFlags_t for each entry */
+    uint32_t cosDeadband[CO_PDO_MAX_MAPPED_ENTRIES]; /**< Deadband for each mapped entry */
+#endif
+#if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_MPDO) != 0) || defined CO_DOXYGEN
+    OD_t* mpdoOD;            /**< From CO_TPDO_initMPDO() */
+    OD_entry_t* mpdoScanner; /**< Object scanner list, from CO_TPDO_initMPDO() */
+    uint8_t mpdoNodeId;      /**< Own node-ID, from CO_TPDO_initMPDO() */
+    uint8_t mpdoDestNodeId;  /**< Node-ID of DAM MPDO consumer, 0 for all nodes */
+    uint8_t mpdoScanSub;     /**< Sub-index of the next entry in object scanner list */
+    uint8_t mpdoScanBlock;   /**< Position of the next object inside block of the object scanner list entry */
+#endif
+#if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_STAGED_MAPPING) != 0) || defined CO_DOXYGEN
+    CO_PDO_stagedMap_t* stagedMap; /**< From CO_TPDO_stageMapping(), NULL if no mapping is staged */
+#endif
 } CO_TPDO_t;
 
 /**
@@ -328,6 +795,7 @@ typedef struct {
  * @param OD Object Dictionary.
  * @param em Emergency object.
  * @param SYNC SYNC object, may be NULL.
+ * @param cold Object for cold data, if CO_CONFIG_PDO_COLD_SPLIT is enabled, see @ref CO_PDO_cold_t.
  * @param preDefinedCanId CAN identifier from pre-defined connection set, including node-id for first four PDOs, or 0
  * otherwise, see @ref CO_PDO_CAN_ID
  * @param OD_18xx_TPDOCommPar OD entry for 0x1800+ - "TPDO communication parameter", entry is required.
@@ -341,6 +809,9 @@ typedef struct {
 CO_ReturnError_t CO_TPDO_init(CO_TPDO_t* TPDO, OD_t* OD, CO_EM_t* em,
 #if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_SYNC_ENABLE) != 0) || defined CO_DOXYGEN
                               CO_SYNC_t* SYNC,
+#endif
+#if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_COLD_SPLIT) != 0) || defined CO_DOXYGEN
+                              CO_PDO_cold_t* cold,
 #endif
                               uint16_t preDefinedCanId, OD_entry_t* OD_18xx_TPDOCommPar, OD_entry_t* OD_1Axx_TPDOMapPar,
                               CO_CANmodule_t* CANdevTx, uint16_t CANdevTxIdx, uint32_t* errInfo);
@@ -360,6 +831,79 @@ CO_TPDOsendRequest(CO_TPDO_t* TPDO) {
     }
 }
 
+#if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_MPDO) != 0) || defined CO_DOXYGEN
+/**
+ * Initialize transmission of SAM MPDO.
+ *
+ * Function must be called after @ref CO_TPDO_init(), if TPDO is configured as SAM MPDO. See @ref CO_PDO_MPDO.
+ *
+ * @param TPDO This object.
+ * @param OD Object Dictionary.
+ * @param nodeId Own node-ID.
+ * @param OD_1FAx_scannerList OD entry for 0x1FA0+ - "Object scanner list" for this TPDO. Each sub-index is UNSIGNED32:
+ * block size (bits 24..31), index (bits 8..23) and sub-index (bits 0..7) of the transmitted OD variables.
+ */
+void CO_TPDO_initMPDO(CO_TPDO_t* TPDO, OD_t* OD, uint8_t nodeId, OD_entry_t* OD_1FAx_scannerList);
+
+/**
+ * Set node-ID of the consumer of DAM MPDO.
+ *
+ * @param TPDO TPDO object.
+ * @param nodeId Node-ID of the consumer, 0 for all nodes (default).
+ */
+static inline void
+CO_TPDO_setMPDOdestination(CO_TPDO_t* TPDO, uint8_t nodeId) {
+    if (TPDO != NULL) {
+        TPDO->mpdoDestNodeId = nodeId & 0x7FU;
+    }
+}
+#endif /* (CO_CONFIG_PDO) & CO_CONFIG_PDO_MPDO */
+
+#if (((CO_CONFIG_PDO)&CO_CONFIG_TPDO_COS) != 0) || defined CO_DOXYGEN
+/**
+ * Configure change of value (COS) transmission of TPDO.
+ *
+ * COS is used with event driven TPDOs (transmission type 0, 254 or 255). If there is no other request for
+ * transmission, then TPDO data are assembled each checkTime_us, but not before inhibit timer expires (or on each SYNC
+ * for transmission type 0), and compared with data of the last transmitted TPDO. TPDO is sent only on meaningful
+ * change, so inhibit time is still respected. Event timer, @ref CO_TPDOsendRequest() and @ref OD_requestTPDO() work as
+ * usual and also restart the check period.
+ *
+ * Note that read() functions of mapped OD variables with IO extension are called on each check. With
+ * CO_CONFIG_FLAG_TIMERNEXT the next check time is reported in timerNext_us.
+ *
+ * Function must be called after @ref CO_TPDO_init(), COS is disabled there. TPDO will be sent on the next opportunity
+ * to obtain new reference data.
+ *
+ * @param TPDO TPDO object.
+ * @param mode COS mode. In CO_TPDO_COS_DEADBAND mode deadbands are configured by @ref CO_TPDO_setDeadband(), by
+ * default each entry has deadband 0 (any change). If CO_CONFIG_PDO_OD_IO_ACCESS is disabled, CO_TPDO_COS_DEADBAND
+ * works as CO_TPDO_COS_PAYLOAD.
+ * @param checkTime_us Period of checks for change of value of event driven TPDO (254, 255) in microseconds. 0 means
+ * check on each @ref CO_TPDO_process() call.
+ */
+void CO_TPDO_setCOS(CO_TPDO_t* TPDO, CO_TPDO_cosMode_t mode, uint32_t checkTime_us);
+
+/**
+ * Configure deadband of mapped entry for CO_TPDO_COS_DEADBAND mode.
+ *
+ * Mapped entry is interpreted as integer of mapped length (up to 64 bits) in CANopen (little-endian) byte order.
+ * TPDO is sent, if absolute difference between new and last transmitted value of any entry is larger than its
+ * deadband. Deadbands are not affected by PDO remapping, they are tied to the position of the mapped entry, so they
+ * can be configured only for currently mapped entries. For floating point values use CO_TPDO_COS_PAYLOAD mode.
+ *
+ * @param TPDO TPDO object.
+ * @param mapIndex Index of the mapped entry, 0 for the first entry (sub-index 1 of the PDO mapping parameter). Must be
+ * less than number of mapped entries.
+ * @param deadband Absolute deadband in units of the mapped value or relative deadband in 1/1000 of the last
+ * transmitted value. 0 means any change.
+ * @param flags Flags from @ref CO_TPDO_cosFlags_t, ORed.
+ *
+ * @return #CO_ReturnError_t CO_ERROR_NO or CO_ERROR_ILLEGAL_ARGUMENT.
+ */
+CO_ReturnError_t CO_TPDO_setDeadband(CO_TPDO_t* TPDO, uint8_t mapIndex, uint32_t deadband, uint8_t flags);
+#endif /* (CO_CONFIG_PDO) & CO_CONFIG_TPDO_COS */
+
 /**
  * Process transmitting PDO messages.
  *
@@ -376,6 +920,195 @@ void CO_TPDO_process(CO_TPDO_t* TPDO,
                      uint32_t timeDifference_us, uint32_t* timerNext_us,
 #endif
                      bool_t NMTisOperational, bool_t syncWas);
+
+#if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_STAGED_MAPPING) != 0) || defined CO_DOXYGEN
+/**
+ * Stage new mapping and CAN-ID of TPDO, see @ref CO_PDO_stagedMap_t.
+ *
+ * Mapping is verified and prepared in stagedMap, TPDO continues to work with the current mapping. New mapping is
+ * swapped in by @ref CO_TPDO_process(). Synchronous TPDO swaps at SYNC, before the TPDO is assembled. Event driven
+ * TPDO swaps at next call and is then sent with the new mapping. Disabled TPDO or TPDO outside NMT operational state
+ * swaps at next call.
+ *
+ * Function must be called from the same thread as processing function or with @ref CO_LOCK_OD locked.
+ *
+ * @param TPDO This object.
+ * @param stagedMap Object, defined by application, it must exist until swap.
+ * @param map Array of mappedObjectsCount new values of mapping parameter, sub-indexes 1...
+ * @param mappedObjectsCount Number of mapped objects, from 1 to CO_PDO_MAX_MAPPED_ENTRIES. MPDO can not be staged.
+ * @param CAN_ID New CAN identifier or 0, if it is not changed. It is written to communication parameter, sub-index 1.
+ *
+ * @return ODR_OK on success, ODR_DATA_DEV_STATE if previous mapping is not swapped yet, ODR_INVALID_VALUE for wrong
+ * CAN_ID or mappedObjectsCount, ODR_MAP_LEN if mapping is too long, or other error of the mapped entry.
+ */
+ODR_t CO_TPDO_stageMapping(CO_TPDO_t* TPDO, CO_PDO_stagedMap_t* stagedMap, const uint32_t* map,
+                           uint8_t mappedObjectsCount, uint16_t CAN_ID);
+#endif
+
+#if (((CO_CONFIG_PDO)&CO_CONFIG_TPDO_SYNC_BALANCE) != 0) || defined CO_DOXYGEN
+/** Phase of cyclic synchronous PDO is not assigned, see @ref CO_PDO_syncBalance() */
+#define CO_PDO_SYNC_PHASE_AUTO 0xFFU
+
+/**
+ * Balance phases of cyclic synchronous PDOs.
+ *
+ * Cyclic synchronous PDO with transmission type N (1 to 240) is transmitted on every N-th SYNC. Phase (0 to N-1) is
+ * the number of SYNCs before its first transmission. Function assigns phases so, that the number of PDOs transmitted
+ * on the same SYNC is as balanced as possible. PDOs with the shortest period are assigned first, each to the phase
+ * with the smallest peak load.
+ *
+ * Function may be used by configuration master for PDOs of the whole network. Master may then configure producers
+ * with SYNC start value (OD 0x1800+, sub-index 6) set to phase + 1, if SYNC counter overflow value (OD 0x1019) is a
+ * common multiple of all transmission types.
+ *
+ * Load is calculated over hyperperiod, the least common multiple of all transmission types, so result is exact. For
+ * unusual combinations of transmission types with hyperperiod longer than 65535 SYNCs, load is calculated over the
+ * first 65535 SYNCs. No load table is used, execution time is proportional to count * count * hyperperiod.
+ *
+ * @param periods Array of transmission types of PDOs. Values outside 1 to 240 are ignored.
+ * @param [in,out] phases Array of phases of PDOs. If value on input is CO_PDO_SYNC_PHASE_AUTO, phase is assigned,
+ * otherwise phase is fixed and only included into load.
+ * @param count Number of PDOs in arrays.
+ *
+ * @return Expected peak number of PDOs transmitted on the same SYNC.
+ */
+uint16_t CO_PDO_syncBalance(const uint8_t* periods, uint8_t* phases, uint16_t count);
+
+/**
+ * Balance phases of local cyclic synchronous TPDOs.
+ *
+ * By default first cyclic synchronous TPDO is sent "somewhere in the middle" of its period, so TPDOs with the same
+ * transmission type are all sent on the same SYNC. This function assigns phases to all valid cyclic synchronous TPDOs,
+ * as described in @ref CO_PDO_syncBalance(). TPDOs, which use SYNC start value, are not changed.
+ *
+ * Function should be called after @ref CO_TPDO_init() of all TPDOs, for example after CO_CANopenInitPDO(). It may
+ * be called again after TPDO configuration changes. TPDOs are restarted, so all phases count from the next SYNC.
+ * Phase is reset, if transmission type of TPDO is changed.
+ *
+ * @param TPDOs Array of TPDO objects.
+ * @param count Number of TPDO objects.
+ *
+ * @return Expected peak number of TPDOs transmitted on the same SYNC.
+ */
+uint16_t CO_TPDO_balanceSync(CO_TPDO_t* TPDOs, uint16_t count);
+#endif /* (CO_CONFIG_PDO) & CO_CONFIG_TPDO_SYNC_BALANCE */
+
+#if (((CO_CONFIG_PDO)&CO_CONFIG_TPDO_LATENCY) != 0) || defined CO_DOXYGEN
+/**
+ * Latency measurement of synchronous TPDOs.
+ *
+ * For each synchronous TPDO (transmission type 0 to 240) two latencies are measured: time from SYNC to
+ * CO_CANsend() and time from SYNC to transmission complete. Minimum, maximum, histogram and number of samples outside
+ * synchronous window length (OD 0x1007) are kept in @ref CO_TPDO_latencyStat_t. Statistics are available in the TPDO
+ * object, over optional manufacturer specific OD record, see @ref CO_TPDO_latencyInitOD(), and over gateway-ascii
+ * command '_pdolat'.
+ *
+ * All timestamps are in microseconds from the same free running clock, specified by @ref CO_TPDO_latencyInitClock().
+ * Measurement is disabled, if clock is not specified.
+ * - Time of SYNC: CAN driver should call @ref CO_TPDO_latencySync() with timestamp of each received SYNC message,
+ *   for example hardware timestamp of the CAN controller. Otherwise (and if this device is SYNC producer) time is
+ *   taken, when SYNC is processed by @ref CO_TPDO_latencyProcess(). In that case delay from SYNC reception to its
+ *   processing is not included.
+ * - Time of CO_CANsend() is taken from the clock.
+ * - Time of transmission complete: CAN driver should call @ref CO_TPDO_latencyTxComplete() with timestamp, when TPDO
+ *   message was transmitted. If it is not called, only the first latency is measured.
+ */
+typedef struct {
+    CO_TPDO_latencyClock_t clock; /**< Time source and time of the last SYNC */
+    CO_TPDO_t* TPDOs;             /**< From CO_TPDO_latencyInit() */
+    uint16_t TPDOcount;           /**< From CO_TPDO_latencyInit() */
+    uint16_t selected;            /**< Index of TPDO, which is shown in OD record, see CO_TPDO_latencyInitOD() */
+    OD_extension_t OD_extension;  /**< Extension for OD object */
+} CO_TPDO_latency_t;
+
+/**
+ * Initialize latency measurement of synchronous TPDOs.
+ *
+ * Function is called from CO_CANopenInitPDO() after @ref CO_TPDO_init() of all TPDOs. It connects TPDOs with the
+ * latency object and resets their statistics. Clock and OD extension are not changed.
+ *
+ * @param latency This object will be initialized.
+ * @param TPDOs Array of TPDO objects.
+ * @param count Number of TPDO objects.
+ *
+ * @return #CO_ReturnError_t CO_ERROR_NO or CO_ERROR_ILLEGAL_ARGUMENT.
+ */
+CO_ReturnError_t CO_TPDO_latencyInit(CO_TPDO_latency_t* latency, CO_TPDO_t* TPDOs, uint16_t count);
+
+/**
+ * Initialize clock for latency measurement of synchronous TPDOs.
+ *
+ * @param latency This object.
+ * @param getTime_us Function, which returns free running time in microseconds. It is called from the same thread as
+ * CO_TPDO_process(). May be NULL to disable measurement.
+ * @param object Pointer to object, which will be passed to getTime_us(). Can be NULL.
+ */
+void CO_TPDO_latencyInitClock(CO_TPDO_latency_t* latency, uint32_t (*getTime_us)(void* object), void* object);
+
+/**
+ * Initialize OD record with latency statistics of synchronous TPDOs.
+ *
+ * Manufacturer specific OD record must contain at least sub-indexes 0 to 9 of type UNSIGNED32 (except sub-index 0),
+ * followed by optional histogram:
+ * - 1: Number of the TPDO (1 for the first TPDO), which statistics are shown (read-write).
+ * - 2: Number of send samples. Write 0 to reset statistics of the shown TPDO.
+ * - 3, 4, 5: Minimum and maximum latency in microseconds from SYNC to CO_CANsend() and number of late samples.
+ * - 6, 7, 8, 9: The same for latency from SYNC to transmission complete, including number of samples.
+ * - 10 to (9 + CO_TPDO_LATENCY_BINS): Histogram of send latency.
+ * - Next CO_TPDO_LATENCY_BINS sub-indexes: Histogram of transmission complete latency.
+ *
+ * @param latency This object.
+ * @param OD_latency OD entry of the record.
+ * @param [out] errInfo Additional information in case of error, may be NULL.
+ *
+ * @return #CO_ReturnError_t CO_ERROR_NO or CO_ERROR_ILLEGAL_ARGUMENT.
+ */
+CO_ReturnError_t CO_TPDO_latencyInitOD(CO_TPDO_latency_t* latency, OD_entry_t* OD_latency, uint32_t* errInfo);
+
+/**
+ * Indicate reception of SYNC message with its timestamp.
+ *
+ * Function may be called by the CAN driver, for example from CAN receive interrupt, for received SYNC messages.
+ *
+ * @param latency This object.
+ * @param timestamp_us Time of SYNC reception, from the same clock as getTime_us().
+ */
+static inline void
+CO_TPDO_latencySync(CO_TPDO_latency_t* latency, uint32_t timestamp_us) {
+    if (latency != NULL) {
+        latency->clock.syncStamp_us = timestamp_us;
+        CO_FLAG_SET(latency->clock.syncStamped);
+    }
+}
+
+/**
+ * Process latency measurement of synchronous TPDOs.
+ *
+ * Function must be called before CO_TPDO_process() of all TPDOs, it is called from CO_process_TPDO().
+ *
+ * @param latency This object.
+ * @param syncWas True, if CANopen SYNC message was just received or transmitted.
+ */
+void CO_TPDO_latencyProcess(CO_TPDO_latency_t* latency, bool_t syncWas);
+
+/**
+ * Indicate transmission complete of the TPDO message.
+ *
+ * Function may be called by the CAN driver, for example from CAN transmit interrupt, when message from
+ * TPDO->CANtxBuff was transmitted. It is ignored, if TPDO is not synchronous.
+ *
+ * @param TPDO TPDO object.
+ * @param timestamp_us Time of transmission complete, from the same clock as getTime_us().
+ */
+void CO_TPDO_latencyTxComplete(CO_TPDO_t* TPDO, uint32_t timestamp_us);
+
+/**
+ * Reset latency statistics of the TPDO.
+ *
+ * @param TPDO TPDO object.
+ */
+void CO_TPDO_latencyReset(CO_TPDO_t* TPDO);
+#endif /* (CO_CONFIG_PDO) & CO_CONFIG_TPDO_LATENCY */
 #endif /* (CO_CONFIG_PDO) & CO_CONFIG_TPDO_ENABLE */
 
 /** @} */ /* CO_PDO */
@@ -41,6 +41,11 @@
 #error CO_CONFIG_FIFO_CRC16_CCITT must be enabled.
 #endif
 #endif
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK_ADAPTIVE) != 0
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK) == 0
+#error CO_CONFIG_SDO_CLI_BLOCK must be enabled.
+#endif
+#endif
 
 /* default 'protocol switch threshold' size for block transfer */
 #ifndef CO_CONFIG_SDO_CLI_PST
@@ -430,6 +435,13 @@ CO_SDOclientDownload(CO_SDOclient_t* SDO_C, uint32_t timeDifference_us, bool_t s
     CO_SDO_return_t ret = CO_SDO_RT_waitingResponse;
     CO_SDO_abortCode_t abortCode = CO_SDO_AB_NONE;
 
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK_ADAPTIVE) != 0
+    if ((SDO_C != NULL) && SDO_C->block_stats.inProgress) {
+        SDO_C->block_stats.time_us += timeDifference_us;
+        SDO_C->block_subBlockTime_us += timeDifference_us;
+    }
+#endif
+
     if ((SDO_C == NULL) || !SDO_C->valid) {
         abortCode = CO_SDO_AB_DEVICE_INCOMPAT;
         ret = CO_SDO_RT_wrongArguments;
@@ -663,6 +675,11 @@ CO_SDOclientDownload(CO_SDOclient_t* SDO_C, uint32_t timeDifference_us, bool_t s
                         }
 
                         SDO_C->block_crc = 0;
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK_ADAPTIVE) != 0
+                        (void)memset(&SDO_C->block_stats, 0, sizeof(SDO_C->block_stats));
+                        SDO_C->block_stats.inProgress = true;
+                        SDO_C->block_stats.blksizeMin = 127;
+#endif
                         SDO_C->block_blksize = SDO_C->CANrxData[4];
                         if ((SDO_C->block_blksize < 1U) || (SDO_C->block_blksize > 127U)) {
                             SDO_C->block_blksize = 127;
@@ -680,6 +697,12 @@ CO_SDOclientDownload(CO_SDOclient_t* SDO_C, uint32_t timeDifference_us, bool_t s
                 case CO_SDO_ST_DOWNLOAD_BLK_SUBBLOCK_REQ:
                 case CO_SDO_ST_DOWNLOAD_BLK_SUBBLOCK_RSP: {
                     if (SDO_C->CANrxData[0] == 0xA2U) {
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK_ADAPTIVE) != 0
+                        if (SDO_C->CANrxData[1] <= SDO_C->block_seqno) {
+                            CO_SDO_blockStatsSubBlock(&SDO_C->block_stats, SDO_C->CANrxData[1], SDO_C->block_seqno,
+                                                      false);
+                        }
+#endif
                         /* check number of segments */
                         if (SDO_C->CANrxData[1] < SDO_C->block_seqno) {
                             /* NOT all segments transferred successfully. Re-transmit data after erroneous segment. */
@@ -1027,6 +1050,14 @@ CO_SDOclientDownload(CO_SDOclient_t* SDO_C, uint32_t timeDifference_us, bool_t s
 #endif
     }
 
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK_ADAPTIVE) != 0
+    /* block transfer finished or aborted, statistics are complete */
+    if ((SDO_C != NULL) && SDO_C->block_stats.inProgress && (SDO_C->state == CO_SDO_ST_IDLE)) {
+        SDO_C->block_stats.inProgress = false;
+        SDO_C->block_stats.bytes = (uint32_t)SDO_C->sizeTran;
+    }
+#endif
+
     if (sizeTransferred != NULL) {
         *sizeTransferred = SDO_C->sizeTran;
     }
@@ -1091,6 +1122,13 @@ CO_SDOclientUpload(CO_SDOclient_t* SDO_C, uint32_t timeDifference_us, bool_t sen
     CO_SDO_return_t ret = CO_SDO_RT_waitingResponse;
     CO_SDO_abortCode_t abortCode = CO_SDO_AB_NONE;
 
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK_ADAPTIVE) != 0
+    if ((SDO_C != NULL) && SDO_C->block_stats.inProgress) {
+        SDO_C->block_stats.time_us += timeDifference_us;
+        SDO_C->block_subBlockTime_us += timeDifference_us;
+    }
+#endif
+
     if ((SDO_C == NULL) || !SDO_C->valid) {
         abortCode = CO_SDO_AB_DEVICE_INCOMPAT;
         ret = CO_SDO_RT_wrongArguments;
@@ -1585,6 +1623,14 @@ CO_SDOclientUpload(CO_SDOclient_t* SDO_C, uint32_t timeDifference_us, bool_t sen
                     break;
                 } else { /* MISRA C 2004 14.10 */
                 }
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK_ADAPTIVE) != 0
+                /* start with maximum block size, adapt it after each sub-block */
+                SDO_C->block_blksizeLimit = 127;
+                SDO_C->block_subBlockTime_us = 0;
+                (void)memset(&SDO_C->block_stats, 0, sizeof(SDO_C->block_stats));
+                SDO_C->block_stats.inProgress = true;
+                SDO_C->block_stats.blksizeMin = 127;
+#endif
                 SDO_C->block_blksize = (uint8_t)count;
                 SDO_C->CANtxBuff->data[4] = SDO_C->block_blksize;
                 SDO_C->CANtxBuff->data[5] = CO_CONFIG_SDO_CLI_PST;
@@ -1619,6 +1665,13 @@ CO_SDOclientUpload(CO_SDOclient_t* SDO_C, uint32_t timeDifference_us, bool_t sen
                 bool_t transferShort = SDO_C->block_seqno != SDO_C->block_blksize;
                 uint8_t seqnoStart = SDO_C->block_seqno;
 #endif
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK_ADAPTIVE) != 0
+                /* new limit is stored after response is sent, this state may repeat, if data buffer is full */
+                uint8_t blksizePrev = SDO_C->block_blksize;
+                uint8_t blksizeLimit = CO_SDO_blockSizeAdapt(SDO_C->block_blksizeLimit, SDO_C->block_seqno, blksizePrev,
+                                                             SDO_C->finished, SDO_C->block_subBlockTime_us,
+                                                             SDO_C->block_SDOtimeoutTime_us);
+#endif
 
                 /* Is last segment? */
                 if (SDO_C->finished) {
@@ -1654,6 +1707,11 @@ CO_SDOclientUpload(CO_SDOclient_t* SDO_C, uint32_t timeDifference_us, bool_t sen
                         break;
                     } else { /* MISRA C 2004 14.10 */
                     }
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK_ADAPTIVE) != 0
+                    if (count > blksizeLimit) {
+                        count = blksizeLimit;
+                    }
+#endif
 
                     SDO_C->block_blksize = (uint8_t)count;
                     SDO_C->block_seqno = 0;
@@ -1664,6 +1722,12 @@ CO_SDOclientUpload(CO_SDOclient_t* SDO_C, uint32_t timeDifference_us, bool_t sen
                 }
 
                 SDO_C->CANtxBuff->data[2] = SDO_C->block_blksize;
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK_ADAPTIVE) != 0
+                CO_SDO_blockStatsSubBlock(&SDO_C->block_stats, SDO_C->CANtxBuff->data[1], blksizePrev,
+                                          SDO_C->finished);
+                SDO_C->block_blksizeLimit = blksizeLimit;
+                SDO_C->block_subBlockTime_us = 0;
+#endif
 
                 /* reset block_timeoutTimer, but not SDO_C->timeoutTimer */
                 SDO_C->block_timeoutTimer = 0;
@@ -1745,6 +1809,14 @@ CO_SDOclientUpload(CO_SDOclient_t* SDO_C, uint32_t timeDifference_us, bool_t sen
 #endif
     }
 
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK_ADAPTIVE) != 0
+    /* block transfer finished or aborted, statistics are complete */
+    if ((SDO_C != NULL) && SDO_C->block_stats.inProgress && (SDO_C->state == CO_SDO_ST_IDLE)) {
+        SDO_C->block_stats.inProgress = false;
+        SDO_C->block_stats.bytes = (uint32_t)SDO_C->sizeTran;
+    }
+#endif
+
     if (sizeIndicated != NULL) {
         *sizeIndicated = SDO_C->sizeInd;
     }
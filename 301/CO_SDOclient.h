@@ -202,6 +202,11 @@ typedef struct {
     uint8_t block_dataUploadLast[7];  /**< Last 7 bytes of data at block upload */
     uint16_t block_crc;               /**< Calculated CRC checksum */
 #endif
+#if (((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK_ADAPTIVE) != 0) || defined CO_DOXYGEN
+    uint8_t block_blksizeLimit;      /**< Block size limit for block upload, see CO_SDO_blockSizeAdapt() */
+    uint32_t block_subBlockTime_us;  /**< Time since sub-block was requested in block upload */
+    CO_SDO_blockStats_t block_stats; /**< Statistics of the last block transfer */
+#endif
 } CO_SDOclient_t;
 
 /**
@@ -40,6 +40,16 @@
 #error CO_CONFIG_SDO_SRV_BUFFER_SIZE must be greater or equal than 900.
 #endif
 #endif
+#if ((CO_CONFIG_SDO_SRV)&(CO_CONFIG_SDO_SRV_BLOCK_DIRECT | CO_CONFIG_SDO_SRV_BLOCK_ADAPTIVE)) != 0
+#if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_BLOCK) == 0
+#error CO_CONFIG_SDO_SRV_BLOCK must be enabled.
+#endif
+#endif
+#if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_BUFFER_POOL) != 0
+#if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_SEGMENTED) == 0
+#error CO_CONFIG_SDO_SRV_SEGMENTED must be enabled.
+#endif
+#endif
 
 /*
  * Read received frame from CAN module.
@@ -56,11 +66,20 @@ CO_SDO_receive(void* object, void* msg) {
     /* ignore frames with wrong length */
     if (DLC == 8U) {
         if (data[0] == 0x80U) {
-            /* abort from client, just make idle */
+            /* abort from client, just make idle, frame received before is not processed */
             SDO->state = CO_SDO_ST_IDLE;
-        } else if (CO_FLAG_READ(SDO->CANrxNew)) {
+            CO_FLAG_CLEAR(SDO->CANrxNew);
+#if CO_CONFIG_SDO_SRV_RX_QUEUE_SIZE > 0
+            /* frames received before abort, which are still in the queue or just being copied into CANrxData, will be
+             * skipped */
+            SDO->CANrxEpoch++;
+#endif
+        }
+#if CO_CONFIG_SDO_SRV_RX_QUEUE_SIZE == 0
+        else if (CO_FLAG_READ(SDO->CANrxNew)) {
             /* ignore frame if previous frame was not processed yet */
         }
+#endif
 #if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_BLOCK) != 0
         else if (SDO->state == CO_SDO_ST_UPLOAD_BLK_END_CRSP && data[0] == 0xA1) {
             /*  SDO block download successfully transferred, just make idle */
@@ -129,9 +148,25 @@ CO_SDO_receive(void* object, void* msg) {
         }
 #endif /* (CO_CONFIG_SDO_SRV) & CO_CONFIG_SDO_SRV_BLOCK */
         else {
+#if CO_CONFIG_SDO_SRV_RX_QUEUE_SIZE > 0
+            /* copy data into the queue, data will be processed in CO_SDOserver_process() */
+            CO_SDOserver_rxSlot_t* slot = &SDO->CANrxQueue[SDO->CANrxQueueWr];
+            if (CO_FLAG_READ(slot->full)) {
+                /* queue is full, frame is lost */
+                SDO->CANrxQueueOverflow++;
+            } else {
+                (void)memcpy(slot->data, data, DLC);
+                slot->epoch = SDO->CANrxEpoch;
+                CO_FLAG_SET(slot->full);
+                SDO->CANrxQueueWr = ((SDO->CANrxQueueWr + 1U) < CO_CONFIG_SDO_SRV_RX_QUEUE_SIZE)
+                                        ? (SDO->CANrxQueueWr + 1U)
+                                        : 0U;
+            }
+#else
             /* copy data and set 'new frame' flag, data will be processed in CO_SDOserver_process() */
             (void)memcpy(SDO->CANrxData, data, DLC);
             CO_FLAG_SET(SDO->CANrxNew);
+#endif
 #if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_FLAG_CALLBACK_PRE) != 0
             /* Optional signal to RTOS, which can resume task, which handles SDO server processing. */
             if (SDO->pFunctSignalPre != NULL) {
@@ -269,6 +304,11 @@ CO_SDOserver_init(CO_SDOserver_t* SDO, OD_t* OD, OD_entry_t* OD_1200_SDOsrvPar,
     SDO->block_SDOtimeoutTime_us = (uint32_t)SDOtimeoutTime_ms * 700;
 #endif
     SDO->state = CO_SDO_ST_IDLE;
+#if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_BUFFER_POOL) != 0
+    SDO->buf = SDO->bufLocal;
+    SDO->bufSize = CO_SDO_SRV_BUF_LOCAL_SIZE;
+    SDO->bufPool = NULL;
+#endif
 
 #if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_FLAG_CALLBACK_PRE) != 0
     SDO->pFunctSignalPre = NULL;
@@ -345,6 +385,16 @@ CO_SDOserver_init(CO_SDOserver_t* SDO, OD_t* OD, OD_entry_t* OD_1200_SDOsrvPar,
         }
     }
     CO_FLAG_CLEAR(SDO->CANrxNew);
+#if CO_CONFIG_SDO_SRV_RX_QUEUE_SIZE > 0
+    for (uint8_t i = 0; i < CO_CONFIG_SDO_SRV_RX_QUEUE_SIZE; i++) {
+        CO_FLAG_CLEAR(SDO->CANrxQueue[i].full);
+    }
+    SDO->CANrxQueueWr = 0;
+    SDO->CANrxQueueRd = 0;
+    SDO->CANrxEpoch = 0;
+    SDO->CANrxDataEpoch = 0;
+    SDO->CANrxQueueOverflow = 0;
+#endif
 
     /* store the parameters and configure CANrx and CANtx */
 #if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_FLAG_OD_DYNAMIC) != 0
@@ -371,6 +421,105 @@ CO_SDOserver_initCallbackPre(CO_SDOserver_t* SDO, void* object, void (*pFunctSig
 }
 #endif
 
+#if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_BUFFER_POOL) != 0
+CO_ReturnError_t
+CO_SDOserver_bufPoolInit(CO_SDOserver_bufPool_t* pool, CO_SDOserver_buf_t bufs[], uint8_t bufCount) {
+    if ((pool == NULL) || (bufs == NULL) || (bufCount < 1U) || (bufCount > 32U)) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
+
+    pool->bufs = bufs;
+    pool->bufCount = bufCount;
+    pool->leased = 0;
+    pool->leasedMax = 0;
+    pool->exhausted = 0;
+
+    return CO_ERROR_NO;
+}
+
+void
+CO_SDOserver_initBufPool(CO_SDOserver_t* SDO, CO_SDOserver_bufPool_t* pool) {
+    if (SDO != NULL) {
+        SDO->bufPool = pool;
+    }
+}
+
+/* Helper function for leasing interim data buffer at the start of new transfer.
+ *
+ * Expedited download does not use the buffer. Upload of variable with known size, which fits into bufLocal, is
+ * completed from bufLocal. All other transfers lease a buffer from the pool.
+ *
+ * @param SDO SDO server
+ * @param upload True for upload, false for download
+ *
+ * Returns false, if buffer from the pool is necessary and it is not available */
+static bool_t
+bufPoolLease(CO_SDOserver_t* SDO, bool_t upload) {
+    CO_SDOserver_bufPool_t* pool = SDO->bufPool;
+    bool_t needed;
+
+    if (SDO->buf != SDO->bufLocal) {
+        /* previous transfer was aborted by client and buffer was not returned yet, keep it */
+        return true;
+    }
+
+    if (upload) {
+        OD_size_t sizeInOd = SDO->OD_IO.stream.dataLength;
+        needed = (sizeInOd == 0U) || (sizeInOd > CO_SDO_SRV_BUF_LOCAL_SIZE)
+                 || ((SDO->OD_IO.stream.attribute & (OD_attr_t)ODA_STR) != 0U);
+    } else {
+        needed = (SDO->state != CO_SDO_ST_DOWNLOAD_INITIATE_REQ) || ((SDO->CANrxData[0] & 0x02U) == 0U);
+    }
+    if (!needed) {
+        return true;
+    }
+
+    if (pool != NULL) {
+        uint8_t freeIdx = pool->bufCount;
+        uint8_t leasedCount = 1;
+
+        for (uint8_t i = 0; i < pool->bufCount; i++) {
+            if ((pool->leased & ((uint32_t)1U << i)) != 0U) {
+                leasedCount++;
+            } else if (freeIdx == pool->bufCount) {
+                freeIdx = i;
+            } else { /* MISRA C 2004 14.10 */
+            }
+        }
+
+        if (freeIdx < pool->bufCount) {
+            pool->leased |= (uint32_t)1U << freeIdx;
+            if (leasedCount > pool->leasedMax) {
+                pool->leasedMax = leasedCount;
+            }
+            SDO->buf = pool->bufs[freeIdx].data;
+            SDO->bufSize = CO_CONFIG_SDO_SRV_BUFFER_SIZE;
+            return true;
+        }
+        pool->exhausted++;
+    }
+    return false;
+}
+
+/* Helper function for returning leased interim data buffer to the pool after the end of transfer.
+ *
+ * @param SDO SDO server
+ */
+static void
+bufPoolRelease(CO_SDOserver_t* SDO) {
+    CO_SDOserver_bufPool_t* pool = SDO->bufPool;
+
+    for (uint8_t i = 0; i < pool->bufCount; i++) {
+        if (SDO->buf == pool->bufs[i].data) {
+            pool->leased &= ~((uint32_t)1U << i);
+            break;
+        }
+    }
+    SDO->buf = SDO->bufLocal;
+    SDO->bufSize = CO_SDO_SRV_BUF_LOCAL_SIZE;
+}
+#endif
+
 #ifdef CO_BIG_ENDIAN
 static inline void
 reverseBytes(void* start, OD_size_t size) {
@@ -520,7 +669,11 @@ readFromOd(CO_SDOserver_t* SDO, CO_SDO_abortCode_t* abortCode, OD_size_t countMi
         SDO->bufOffsetWr = countRemain;
 
         /* Get size of free data buffer */
+#if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_BUFFER_POOL) != 0
+        OD_size_t countRdRequest = SDO->bufSize - countRemain;
+#else
         OD_size_t countRdRequest = CO_CONFIG_SDO_SRV_BUFFER_SIZE - countRemain;
+#endif
 
         /* load data from OD variable into the buffer */
         OD_size_t countRd = 0;
@@ -590,6 +743,35 @@ readFromOd(CO_SDOserver_t* SDO, CO_SDO_abortCode_t* abortCode, OD_size_t countMi
 }
 #endif
 
+#if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_BLOCK_DIRECT) != 0
+/* Helper function for block upload directly from the original location of OD variable.
+ *
+ * OD variable must have known size and must be read with OD_readOriginal(), so its data are contiguous in memory and
+ * SDO->buf is not necessary. Strings and multi-byte variables on big endian targets are not transferred directly,
+ * because their data must be modified. Variables, which fit into SDO->buf, are not transferred directly, because buffer
+ * keeps consistent copy of the data. Segments are copied from OD variable and CRC is calculated from them when they are
+ * sent for the first time, so retransmitted segments may differ, if data of the variable change during the transfer.
+ *
+ * @param SDO SDO server
+ *
+ * Returns pointer to the data or NULL, if OD variable must be read with readFromOd() */
+static const uint8_t*
+blockUploadDirectData(const CO_SDOserver_t* SDO) {
+    const OD_stream_t* stream = &SDO->OD_IO.stream;
+
+    if ((SDO->OD_IO.read != OD_readOriginal) || (stream->dataOrig == NULL) || (stream->dataLength == 0U)
+        || (stream->dataLength <= CO_CONFIG_SDO_SRV_BUFFER_SIZE) || ((stream->attribute & (OD_attr_t)ODA_STR) != 0U)) {
+        return NULL;
+    }
+#ifdef CO_BIG_ENDIAN
+    if ((stream->attribute & (OD_attr_t)ODA_MB) != 0U) {
+        return NULL;
+    }
+#endif
+    return stream->dataOrig;
+}
+#endif
+
 CO_SDO_return_t
 CO_SDOserver_process(CO_SDOserver_t* SDO, bool_t NMTisPreOrOperational, uint32_t timeDifference_us,
                      uint32_t* timerNext_us) {
@@ -601,8 +783,35 @@ CO_SDOserver_process(CO_SDOserver_t* SDO, bool_t NMTisPreOrOperational, uint32_t
 
     CO_SDO_return_t ret = CO_SDO_RT_waitingResponse;
     CO_SDO_abortCode_t abortCode = CO_SDO_AB_NONE;
+
+#if CO_CONFIG_SDO_SRV_RX_QUEUE_SIZE > 0
+    /* take next frame from the queue, skip frames received before abort from client */
+    while (!CO_FLAG_READ(SDO->CANrxNew) && CO_FLAG_READ(SDO->CANrxQueue[SDO->CANrxQueueRd].full)) {
+        CO_SDOserver_rxSlot_t* slot = &SDO->CANrxQueue[SDO->CANrxQueueRd];
+        if (slot->epoch == SDO->CANrxEpoch) {
+            (void)memcpy(SDO->CANrxData, slot->data, sizeof(SDO->CANrxData));
+            SDO->CANrxDataEpoch = slot->epoch;
+            CO_FLAG_SET(SDO->CANrxNew);
+        }
+        CO_FLAG_CLEAR(slot->full);
+        SDO->CANrxQueueRd = ((SDO->CANrxQueueRd + 1U) < CO_CONFIG_SDO_SRV_RX_QUEUE_SIZE) ? (SDO->CANrxQueueRd + 1U)
+                                                                                         : 0U;
+    }
+    /* abort from client may be received after the frame was taken from the queue */
+    if (CO_FLAG_READ(SDO->CANrxNew) && (SDO->CANrxDataEpoch != SDO->CANrxEpoch)) {
+        CO_FLAG_CLEAR(SDO->CANrxNew);
+    }
+#endif
+
     bool_t isNew = CO_FLAG_READ(SDO->CANrxNew);
 
+#if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_BLOCK_ADAPTIVE) != 0
+    if (SDO->block_stats.inProgress) {
+        SDO->block_stats.time_us += timeDifference_us;
+        SDO->block_subBlockTime_us += timeDifference_us;
+    }
+#endif
+
     if ((SDO->state == CO_SDO_ST_IDLE) && SDO->valid && !isNew) {
         /* Idle and nothing new */
         ret = CO_SDO_RT_ok_communicationEnd;
@@ -661,6 +870,14 @@ CO_SDOserver_process(CO_SDOserver_t* SDO, bool_t NMTisPreOrOperational, uint32_t
                 }
             }
 
+#if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_BUFFER_POOL) != 0
+            /* lease interim data buffer from the pool, if transfer needs it */
+            if ((abortCode == CO_SDO_AB_NONE) && !bufPoolLease(SDO, upload)) {
+                abortCode = CO_SDO_AB_NO_RESOURCE;
+                SDO->state = CO_SDO_ST_ABORT;
+            }
+#endif
+
 #if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_SEGMENTED) != 0
             /* load data from object dictionary, if upload and no error */
             if (upload && (abortCode == CO_SDO_AB_NONE)) {
@@ -668,8 +885,22 @@ CO_SDOserver_process(CO_SDOserver_t* SDO, bool_t NMTisPreOrOperational, uint32_t
                 SDO->bufOffsetWr = 0;
                 SDO->sizeTran = 0;
                 SDO->finished = false;
-
-                if (readFromOd(SDO, &abortCode, 7, false)) {
+                bool_t readOd = true;
+
+#if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_BLOCK_DIRECT) != 0
+                /* OD variable in contiguous memory is block uploaded directly, whole data are available, skip reading
+                 * into the buffer */
+                SDO->block_dataOD = (SDO->state == CO_SDO_ST_UPLOAD_BLK_INITIATE_REQ) ? blockUploadDirectData(SDO)
+                                                                                     : NULL;
+                SDO->block_crcOffset = 0;
+                if (SDO->block_dataOD != NULL) {
+                    SDO->sizeInd = SDO->OD_IO.stream.dataLength;
+                    SDO->bufOffsetWr = SDO->sizeInd;
+                    SDO->finished = true;
+                    readOd = false;
+                }
+#endif
+                if (readOd && readFromOd(SDO, &abortCode, 7, false)) {
                     /* Size of variable in OD (may not be known yet) */
                     if (SDO->finished) {
                         /* OD variable was completely read, its size is known */
@@ -941,10 +1172,18 @@ CO_SDOserver_process(CO_SDOserver_t* SDO, bool_t NMTisPreOrOperational, uint32_t
                     if (SDO->sizeInd > 0 && SDO->CANrxData[5] > 0 && SDO->CANrxData[5] >= SDO->sizeInd) {
                         SDO->state = CO_SDO_ST_UPLOAD_INITIATE_RSP;
                     } else {
-                        /* data were already loaded from OD variable, verify crc */
+                        /* data were already loaded from OD variable, verify crc. In direct upload crc is calculated
+                         * from segments, when they are sent. */
                         if ((SDO->CANrxData[0] & 0x04) != 0) {
                             SDO->block_crcEnabled = true;
-                            SDO->block_crc = crc16_ccitt(SDO->buf, SDO->bufOffsetWr, 0);
+#if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_BLOCK_DIRECT) != 0
+                            if (SDO->block_dataOD != NULL) {
+                                SDO->block_crc = 0;
+                            } else
+#endif
+                            {
+                                SDO->block_crc = crc16_ccitt(SDO->buf, SDO->bufOffsetWr, 0);
+                            }
                         } else {
                             SDO->block_crcEnabled = false;
                         }
@@ -963,6 +1202,11 @@ CO_SDOserver_process(CO_SDOserver_t* SDO, bool_t NMTisPreOrOperational, uint32_t
                             SDO->state = CO_SDO_ST_ABORT;
                             break;
                         }
+#if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_BLOCK_ADAPTIVE) != 0
+                        (void)memset(&SDO->block_stats, 0, sizeof(SDO->block_stats));
+                        SDO->block_stats.inProgress = true;
+                        SDO->block_stats.blksizeMin = 127;
+#endif
                         SDO->state = CO_SDO_ST_UPLOAD_BLK_INITIATE_RSP;
                     }
                     break;
@@ -989,6 +1233,11 @@ CO_SDOserver_process(CO_SDOserver_t* SDO, bool_t NMTisPreOrOperational, uint32_t
                             break;
                         }
 
+#if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_BLOCK_ADAPTIVE) != 0
+                        if (SDO->CANrxData[1] <= SDO->block_seqno) {
+                            CO_SDO_blockStatsSubBlock(&SDO->block_stats, SDO->CANrxData[1], SDO->block_seqno, false);
+                        }
+#endif
                         /* check number of segments */
                         if (SDO->CANrxData[1] < SDO->block_seqno) {
                             /* NOT all segments transferred successfully. Re-transmit data after erroneous segment. */
@@ -1296,6 +1545,14 @@ CO_SDOserver_process(CO_SDOserver_t* SDO, bool_t NMTisPreOrOperational, uint32_t
                 if (count > 127) {
                     count = 127;
                 }
+#if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_BLOCK_ADAPTIVE) != 0
+                /* start with maximum block size, adapt it after each sub-block */
+                SDO->block_blksizeLimit = 127;
+                SDO->block_subBlockTime_us = 0;
+                (void)memset(&SDO->block_stats, 0, sizeof(SDO->block_stats));
+                SDO->block_stats.inProgress = true;
+                SDO->block_stats.blksizeMin = 127;
+#endif
                 SDO->block_blksize = (uint8_t)count;
                 SDO->CANtxBuff->data[4] = SDO->block_blksize;
 
@@ -1325,6 +1582,15 @@ CO_SDOserver_process(CO_SDOserver_t* SDO, bool_t NMTisPreOrOperational, uint32_t
                 uint8_t seqnoStart = SDO->block_seqno;
 #endif
 
+#if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_BLOCK_ADAPTIVE) != 0
+                CO_SDO_blockStatsSubBlock(&SDO->block_stats, SDO->block_seqno, SDO->block_blksize, SDO->finished);
+                SDO->block_blksizeLimit = CO_SDO_blockSizeAdapt(SDO->block_blksizeLimit, SDO->block_seqno,
+                                                                SDO->block_blksize, SDO->finished,
+                                                                SDO->block_subBlockTime_us,
+                                                                SDO->block_SDOtimeoutTime_us);
+                SDO->block_subBlockTime_us = 0;
+#endif
+
                 /* Is last segment? */
                 if (SDO->finished) {
                     SDO->state = CO_SDO_ST_DOWNLOAD_BLK_END_REQ;
@@ -1345,6 +1611,11 @@ CO_SDOserver_process(CO_SDOserver_t* SDO, bool_t NMTisPreOrOperational, uint32_t
                             count = 127;
                         }
                     }
+#if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_BLOCK_ADAPTIVE) != 0
+                    if (count > SDO->block_blksizeLimit) {
+                        count = SDO->block_blksizeLimit;
+                    }
+#endif
 
                     SDO->block_blksize = (uint8_t)count;
                     SDO->block_seqno = 0;
@@ -1399,50 +1670,76 @@ CO_SDOserver_process(CO_SDOserver_t* SDO, bool_t NMTisPreOrOperational, uint32_t
             }
 
             case CO_SDO_ST_UPLOAD_BLK_SUBBLOCK_SREQ: {
-                /* write header and get current count */
-                SDO->CANtxBuff->data[0] = ++SDO->block_seqno;
-                OD_size_t count = SDO->bufOffsetWr - SDO->bufOffsetRd;
-                /* verify, if this is the last segment */
-                if (count < 7 || (SDO->finished && count == 7)) {
-                    SDO->CANtxBuff->data[0] |= 0x80;
-                } else {
-                    count = 7;
-                }
+                /* If CAN transmit buffer is free after the segment was sent, send next segments in the same call. */
+                uint8_t loop = 0;
+                do {
+                    if (loop > 0U) {
+                        (void)memset(SDO->CANtxBuff->data, 0, sizeof(SDO->CANtxBuff->data));
+                    }
+                    /* write header and get current count */
+                    SDO->CANtxBuff->data[0] = ++SDO->block_seqno;
+                    OD_size_t count = SDO->bufOffsetWr - SDO->bufOffsetRd;
+                    /* verify, if this is the last segment */
+                    if (count < 7 || (SDO->finished && count == 7)) {
+                        SDO->CANtxBuff->data[0] |= 0x80;
+                    } else {
+                        count = 7;
+                    }
 
-                /* copy data segment to CAN frame */
-                (void)memcpy(&SDO->CANtxBuff->data[1], SDO->buf + SDO->bufOffsetRd, count);
-                SDO->bufOffsetRd += count;
-                SDO->block_noData = (uint8_t)(7 - count);
-                SDO->sizeTran += count;
+                    /* copy data segment to CAN frame */
+#if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_BLOCK_DIRECT) != 0
+                    if (SDO->block_dataOD != NULL) {
+                        CO_LOCK_OD(SDO->CANdevTx);
+                        (void)memcpy(&SDO->CANtxBuff->data[1], SDO->block_dataOD + SDO->bufOffsetRd, count);
+                        CO_UNLOCK_OD(SDO->CANdevTx);
 
-                /* verify if sizeTran is too large or too short if last segment */
-                if (SDO->sizeInd > 0) {
-                    if (SDO->sizeTran > SDO->sizeInd) {
-                        abortCode = CO_SDO_AB_DATA_LONG;
-                        SDO->state = CO_SDO_ST_ABORT;
-                        break;
-                    } else if (SDO->bufOffsetWr == SDO->bufOffsetRd && SDO->sizeTran < SDO->sizeInd) {
-                        abortCode = CO_SDO_AB_DATA_SHORT;
-                        SDO->state = CO_SDO_ST_ABORT;
-                        break;
+                        /* update the crc with data sent for the first time, not with retransmitted data */
+                        OD_size_t end = SDO->bufOffsetRd + count;
+                        if (SDO->block_crcEnabled && (end > SDO->block_crcOffset)) {
+                            OD_size_t skip = SDO->block_crcOffset - SDO->bufOffsetRd;
+                            SDO->block_crc = crc16_ccitt(&SDO->CANtxBuff->data[1U + skip], count - skip,
+                                                         SDO->block_crc);
+                            SDO->block_crcOffset = end;
+                        }
+                    } else
+#endif
+                    {
+                        (void)memcpy(&SDO->CANtxBuff->data[1], SDO->buf + SDO->bufOffsetRd, count);
                     }
-                }
+                    SDO->bufOffsetRd += count;
+                    SDO->block_noData = (uint8_t)(7 - count);
+                    SDO->sizeTran += count;
 
-                /* is last segment or all segments in current block transferred? */
-                if (SDO->bufOffsetWr == SDO->bufOffsetRd || SDO->block_seqno >= SDO->block_blksize) {
-                    SDO->state = CO_SDO_ST_UPLOAD_BLK_SUBBLOCK_CRSP;
-                }
+                    /* verify if sizeTran is too large or too short if last segment */
+                    if (SDO->sizeInd > 0) {
+                        if (SDO->sizeTran > SDO->sizeInd) {
+                            abortCode = CO_SDO_AB_DATA_LONG;
+                            SDO->state = CO_SDO_ST_ABORT;
+                            break;
+                        } else if (SDO->bufOffsetWr == SDO->bufOffsetRd && SDO->sizeTran < SDO->sizeInd) {
+                            abortCode = CO_SDO_AB_DATA_SHORT;
+                            SDO->state = CO_SDO_ST_ABORT;
+                            break;
+                        }
+                    }
+
+                    /* is last segment or all segments in current block transferred? */
+                    if (SDO->bufOffsetWr == SDO->bufOffsetRd || SDO->block_seqno >= SDO->block_blksize) {
+                        SDO->state = CO_SDO_ST_UPLOAD_BLK_SUBBLOCK_CRSP;
+                    }
 #if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_FLAG_TIMERNEXT) != 0
-                else {
-                    /* Inform OS to call this function again without delay. */
-                    if (timerNext_us != NULL) {
-                        *timerNext_us = 0;
+                    else {
+                        /* Inform OS to call this function again without delay. */
+                        if (timerNext_us != NULL) {
+                            *timerNext_us = 0;
+                        }
                     }
-                }
 #endif
-                /* reset timeout timer and send CAN frame */
-                SDO->timeoutTimer = 0;
-                (void)CO_CANsend(SDO->CANdevTx, SDO->CANtxBuff);
+                    /* reset timeout timer and send CAN frame */
+                    SDO->timeoutTimer = 0;
+                    (void)CO_CANsend(SDO->CANdevTx, SDO->CANtxBuff);
+                } while ((SDO->state == CO_SDO_ST_UPLOAD_BLK_SUBBLOCK_SREQ) && !SDO->CANtxBuff->bufferFull
+                         && (++loop < CO_CONFIG_SDO_SRV_BLOCK_UL_LOOP));
                 break;
             }
 
@@ -1516,5 +1813,27 @@ CO_SDOserver_process(CO_SDOserver_t* SDO, bool_t NMTisPreOrOperational, uint32_t
 #endif
     }
 
+#if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_BLOCK_ADAPTIVE) != 0
+    /* block transfer finished or aborted, statistics are complete */
+    if (SDO->block_stats.inProgress && (SDO->state == CO_SDO_ST_IDLE)) {
+        SDO->block_stats.inProgress = false;
+        SDO->block_stats.bytes = (uint32_t)SDO->sizeTran;
+    }
+#endif
+
+#if (CO_CONFIG_SDO_SRV_RX_QUEUE_SIZE > 0) && (((CO_CONFIG_SDO_SRV)&CO_CONFIG_FLAG_TIMERNEXT) != 0)
+    /* more frames are waiting in the queue, process them without delay */
+    if ((timerNext_us != NULL) && CO_FLAG_READ(SDO->CANrxQueue[SDO->CANrxQueueRd].full)) {
+        *timerNext_us = 0;
+    }
+#endif
+
+#if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_BUFFER_POOL) != 0
+    /* transfer finished or aborted, return the buffer to the pool */
+    if ((SDO->state == CO_SDO_ST_IDLE) && (SDO->buf != SDO->bufLocal)) {
+        bufPoolRelease(SDO);
+    }
+#endif
+
     return ret;
 }
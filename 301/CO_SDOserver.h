@@ -33,6 +33,15 @@
 #ifndef CO_CONFIG_SDO_SRV_BUFFER_SIZE
 #define CO_CONFIG_SDO_SRV_BUFFER_SIZE 32U
 #endif
+#ifndef CO_CONFIG_SDO_SRV_BUFFER_POOL_COUNT
+#define CO_CONFIG_SDO_SRV_BUFFER_POOL_COUNT 1U
+#endif
+#ifndef CO_CONFIG_SDO_SRV_BLOCK_UL_LOOP
+#define CO_CONFIG_SDO_SRV_BLOCK_UL_LOOP 1U
+#endif
+#ifndef CO_CONFIG_SDO_SRV_RX_QUEUE_SIZE
+#define CO_CONFIG_SDO_SRV_RX_QUEUE_SIZE 0U
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -353,6 +362,141 @@ typedef enum {
     CO_SDO_RT_endedWithServerAbort = -10, /**< Communication ended with server abort */
 } CO_SDO_return_t;
 
+/** Increment of block size limit after sub-block, which was received without loss, see CO_SDO_blockSizeAdapt() */
+#ifndef CO_SDO_BLKSIZE_ADAPT_STEP
+#define CO_SDO_BLKSIZE_ADAPT_STEP 8U
+#endif
+/** Minimum block size limit, see CO_SDO_blockSizeAdapt() */
+#ifndef CO_SDO_BLKSIZE_ADAPT_MIN
+#define CO_SDO_BLKSIZE_ADAPT_MIN 4U
+#endif
+
+/**
+ * Statistics of one SDO block transfer.
+ *
+ * Statistics are used by SDO server and SDO client, if CO_CONFIG_SDO_SRV_BLOCK_ADAPTIVE or
+ * CO_CONFIG_SDO_CLI_BLOCK_ADAPTIVE is set. They are reset at the start of block transfer and remain available after the
+ * end of the transfer, until next block transfer starts. Throughput in bytes per second is
+ * bytes * 1000000 / time_us and retransmission rate is segmentsRepeated / (segments + segmentsRepeated).
+ */
+typedef struct {
+    bool_t inProgress;         /**< True, while block transfer is in progress */
+    uint8_t blksizeMin;        /**< Smallest block size used in the transfer */
+    uint8_t blksizeMax;        /**< Largest block size used in the transfer */
+    uint16_t subBlocks;        /**< Number of transferred sub-blocks */
+    uint16_t subBlocksFailed;  /**< Number of sub-blocks, in which some segments were lost or not received in time */
+    uint32_t segments;         /**< Number of segments, transferred successfully */
+    uint32_t segmentsRepeated; /**< Number of segments, which must be repeated. Receiver counts segments of sub-block
+                                  after the lost one, sender counts sent and not confirmed segments. */
+    uint32_t bytes;            /**< Number of data bytes transferred */
+    uint32_t time_us;          /**< Duration of the transfer in microseconds, as seen by the process function */
+} CO_SDO_blockStats_t;
+
+/**
+ * Adapt block size limit after sub-block was received by SDO server or SDO client.
+ *
+ * Receiver of the block transfer (server in download, client in upload) determines the block size for each sub-block.
+ * If sub-block was received without loss, then the limit is increased by @ref CO_SDO_BLKSIZE_ADAPT_STEP. If some
+ * segments were lost, then the limit is decreased by one quarter, which reduces number of segments, which sender
+ * transmits after the lost one. Decrease is limited by the ratio between the sub-block timeout and the observed time
+ * per segment (link speed and processing latency of both sides): if the last segment of the sub-block is lost, receiver
+ * waits for the sub-block timeout, which is more likely with small blocks. Limit is not decreased, while its square is
+ * smaller than the ratio, and never below @ref CO_SDO_BLKSIZE_ADAPT_MIN. Limit is not decreased after sub-block
+ * timeout. So on a fast link block size stays large and on a slow link with lost frames it decreases. Actual block
+ * size is further limited by free buffer space.
+ *
+ * @param blksizeLimit Current block size limit, 1..127.
+ * @param seqno Sequence number of the last correctly received segment in sub-block.
+ * @param blksize Block size of the sub-block.
+ * @param finished True, if the last segment of the transfer was received.
+ * @param subBlockTime_us Time from sub-block request to the end of the sub-block.
+ * @param block_SDOtimeoutTime_us Timeout time for SDO sub-block.
+ *
+ * @return New block size limit, 1..127.
+ */
+static inline uint8_t
+CO_SDO_blockSizeAdapt(uint8_t blksizeLimit, uint8_t seqno, uint8_t blksize, bool_t finished, uint32_t subBlockTime_us,
+                      uint32_t block_SDOtimeoutTime_us) {
+    uint8_t limit = blksizeLimit;
+
+    if (finished) {
+        /* no more sub-blocks */
+    } else if ((seqno < blksize) && (subBlockTime_us < block_SDOtimeoutTime_us)) {
+        /* segment was lost inside the sub-block. If sub-block ended with timeout, the last segment was lost, then
+         * keep the limit, because smaller blocks would end with timeout more often. */
+        uint32_t segmentTime_us = subBlockTime_us / ((seqno > 0U) ? seqno : 1U);
+        uint32_t ratio = block_SDOtimeoutTime_us / ((segmentTime_us > 0U) ? segmentTime_us : 1U);
+        uint8_t limitNew = limit - (limit / 4U);
+
+        if ((limitNew >= CO_SDO_BLKSIZE_ADAPT_MIN) && (((uint32_t)limitNew * limitNew) >= ratio)) {
+            limit = limitNew;
+        }
+    } else if (seqno == limit) {
+        /* grow only if the whole limit was used */
+        limit = (limit < (127U - CO_SDO_BLKSIZE_ADAPT_STEP)) ? (limit + CO_SDO_BLKSIZE_ADAPT_STEP) : 127U;
+    } else { /* MISRA C 2004 14.10 */
+    }
+    return limit;
+}
+
+/**
+ * Update statistics of SDO block transfer after sub-block.
+ *
+ * @param stats Statistics object.
+ * @param seqno Sequence number of the last correctly transferred segment in sub-block.
+ * @param blksize Block size of the sub-block. Sender of the block transfer passes number of sent segments.
+ * @param finished True, if the last segment of the transfer was received. Sender of the block transfer passes false.
+ */
+static inline void
+CO_SDO_blockStatsSubBlock(CO_SDO_blockStats_t* stats, uint8_t seqno, uint8_t blksize, bool_t finished) {
+    stats->subBlocks++;
+    stats->segments += seqno;
+    if (!finished && (seqno < blksize)) {
+        stats->subBlocksFailed++;
+        stats->segmentsRepeated += (uint32_t)blksize - seqno;
+    }
+    if (blksize < stats->blksizeMin) {
+        stats->blksizeMin = blksize;
+    }
+    if (blksize > stats->blksizeMax) {
+        stats->blksizeMax = blksize;
+    }
+}
+
+#if (((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_BUFFER_POOL) != 0) || defined CO_DOXYGEN
+/** Size of the small buffer inside SDO server object, used if buffer from the pool is not necessary */
+#define CO_SDO_SRV_BUF_LOCAL_SIZE 7U
+
+/**
+ * One interim data buffer in the pool for segmented or block transfer.
+ */
+typedef struct {
+    uint8_t data[CO_CONFIG_SDO_SRV_BUFFER_SIZE + 1U]; /**< Data buffer + byte for '\0' */
+} CO_SDOserver_buf_t;
+
+/**
+ * Pool of interim data buffers, shared by SDO servers, see @ref CO_CONFIG_SDO_SRV_BUFFER_POOL.
+ */
+typedef struct {
+    CO_SDOserver_buf_t* bufs; /**< From CO_SDOserver_bufPoolInit() */
+    uint8_t bufCount;         /**< From CO_SDOserver_bufPoolInit() */
+    uint32_t leased;          /**< Bit mask of buffers, which are currently leased by SDO servers */
+    uint8_t leasedMax;        /**< Maximum number of simultaneously leased buffers */
+    uint16_t exhausted;       /**< Number of transfers aborted, because no buffer was available */
+} CO_SDOserver_bufPool_t;
+#endif
+
+#if (CO_CONFIG_SDO_SRV_RX_QUEUE_SIZE > 0) || defined CO_DOXYGEN
+/**
+ * One received CAN frame in the receive queue of SDO server, see @ref CO_CONFIG_SDO_SRV_RX_QUEUE_SIZE.
+ */
+typedef struct {
+    volatile void* full; /**< Indicates, if slot contains received frame, which was not processed yet */
+    uint8_t epoch;       /**< Value of CO_SDOserver_t.CANrxEpoch at frame reception */
+    uint8_t data[8];     /**< 8 data bytes of the received message */
+} CO_SDOserver_rxSlot_t;
+#endif
+
 /**
  * SDO server object.
  */
@@ -369,6 +513,15 @@ typedef struct {
     volatile void* CANrxNew;       /**< Indicates, if new SDO message received from CAN bus. It is not cleared,
                                       until received message is completely processed. */
     uint8_t CANrxData[8];          /**< 8 data bytes of the received message */
+#if (CO_CONFIG_SDO_SRV_RX_QUEUE_SIZE > 0) || defined CO_DOXYGEN
+    CO_SDOserver_rxSlot_t CANrxQueue[CO_CONFIG_SDO_SRV_RX_QUEUE_SIZE]; /**< Queue of received frames, which are
+                                                                          copied into CANrxData one by one */
+    uint8_t CANrxQueueWr;        /**< Next slot for write, used by receive function only */
+    uint8_t CANrxQueueRd;        /**< Next slot for read, used by CO_SDOserver_process() only */
+    volatile uint8_t CANrxEpoch; /**< Incremented by abort from client, frames received before are skipped */
+    uint8_t CANrxDataEpoch;      /**< Value of CO_SDOserver_rxSlot_t.epoch of the frame in CANrxData */
+    uint16_t CANrxQueueOverflow; /**< Number of frames lost, because queue was full */
+#endif
 #if (((CO_CONFIG_SDO_SRV)&CO_CONFIG_FLAG_OD_DYNAMIC) != 0) || defined CO_DOXYGEN
     CO_CANmodule_t* CANdevRx;         /**< From CO_SDOserver_init() */
     uint16_t CANdevRxIdx;             /**< From CO_SDOserver_init() */
@@ -389,8 +542,15 @@ typedef struct {
                                    is finished (by upload) */
     uint32_t SDOtimeoutTime_us; /**< Maximum timeout time between request and response in microseconds */
     uint32_t timeoutTimer;      /**< Timeout timer for SDO communication */
+#if (((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_BUFFER_POOL) != 0) || defined CO_DOXYGEN
+    uint8_t* buf;          /**< Interim data buffer, leased from bufPool or bufLocal */
+    OD_size_t bufSize;     /**< Size of buf without byte for '\0' */
+    uint8_t bufLocal[CO_SDO_SRV_BUF_LOCAL_SIZE + 1U]; /**< Small buffer for expedited and short transfers */
+    CO_SDOserver_bufPool_t* bufPool; /**< From CO_SDOserver_initBufPool() or NULL */
+#else
     uint8_t buf[CO_CONFIG_SDO_SRV_BUFFER_SIZE + 1U]; /**< Interim data buffer for segmented or
                                                         block transfer + byte for '\0' */
+#endif
     OD_size_t bufOffsetWr; /**< Offset of next free data byte available for write in the buffer. */
     OD_size_t bufOffsetRd; /**< Offset of first data available for read in the buffer */
 #endif
@@ -403,6 +563,17 @@ typedef struct {
     bool_t block_crcEnabled;          /**< Client CRC support in block transfer */
     uint16_t block_crc;               /**< Calculated CRC checksum */
 #endif
+#if (((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_BLOCK_ADAPTIVE) != 0) || defined CO_DOXYGEN
+    uint8_t block_blksizeLimit;     /**< Block size limit for block download, see CO_SDO_blockSizeAdapt() */
+    uint32_t block_subBlockTime_us; /**< Time since sub-block was requested in block download */
+    CO_SDO_blockStats_t block_stats; /**< Statistics of the last block transfer */
+#endif
+#if (((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_BLOCK_DIRECT) != 0) || defined CO_DOXYGEN
+    const uint8_t* block_dataOD; /**< Original location of OD variable in block upload directly from OD memory, or
+                                    NULL if data are transferred through buf. If not NULL, bufOffsetWr and bufOffsetRd
+                                    are offsets inside block_dataOD. */
+    OD_size_t block_crcOffset;   /**< Offset inside block_dataOD, up to which data are included in block_crc */
+#endif
 #if (((CO_CONFIG_SDO_SRV)&CO_CONFIG_FLAG_CALLBACK_PRE) != 0) || defined CO_DOXYGEN
     void (*pFunctSignalPre)(void* object); /**< From CO_SDOserver_initCallbackPre() or NULL */
     void* functSignalObjectPre;            /**< From CO_SDOserver_initCallbackPre() or NULL */
@@ -449,6 +620,39 @@ CO_ReturnError_t CO_SDOserver_init(CO_SDOserver_t* SDO, OD_t* OD, OD_entry_t* OD
 void CO_SDOserver_initCallbackPre(CO_SDOserver_t* SDO, void* object, void (*pFunctSignalPre)(void* object));
 #endif
 
+#if (((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_BUFFER_POOL) != 0) || defined CO_DOXYGEN
+/**
+ * Initialize pool of interim data buffers for SDO servers.
+ *
+ * Function must be called in the communication reset section, before CO_SDOserver_initBufPool(). All buffers are
+ * returned to the pool.
+ *
+ * @param pool This object will be initialized.
+ * @param bufs Array of bufCount buffers, defined by application. Each buffer has #CO_CONFIG_SDO_SRV_BUFFER_SIZE bytes.
+ * @param bufCount Number of buffers in the pool, 1 to 32. It is the maximum number of SDO servers, which can have
+ * segmented or block transfer in progress at the same time.
+ *
+ * @return @ref CO_ReturnError_t CO_ERROR_NO in case of success.
+ */
+CO_ReturnError_t CO_SDOserver_bufPoolInit(CO_SDOserver_bufPool_t* pool, CO_SDOserver_buf_t bufs[], uint8_t bufCount);
+
+/**
+ * Assign pool of interim data buffers to SDO server.
+ *
+ * Function must be called after CO_SDOserver_init(). SDO server leases a buffer from the pool, when segmented or block
+ * transfer starts, and returns it, when transfer ends. If no buffer is available, transfer is aborted with
+ * CO_SDO_AB_NO_RESOURCE. Expedited transfers and upload of variables up to #CO_SDO_SRV_BUF_LOCAL_SIZE bytes (not
+ * strings) do not need the pool. Without the pool only such transfers are possible.
+ *
+ * Pool is not protected by critical sections, so all SDO servers, which share the pool, must be processed from the same
+ * thread, as in CO_process().
+ *
+ * @param SDO This object.
+ * @param pool Pool initialized by CO_SDOserver_bufPoolInit(), may be shared by many SDO servers.
+ */
+void CO_SDOserver_initBufPool(CO_SDOserver_t* SDO, CO_SDOserver_bufPool_t* pool);
+#endif
+
 /**
  * Process SDO communication.
  *
@@ -116,6 +116,35 @@ extern "C" {
 #endif
 /** @} */ /* CO_STACK_CONFIG_COMMON */
 
+/**
+ * @defgroup CO_STACK_CONFIG_OD Object Dictionary interface
+ * @{
+ */
+/**
+ * Configuration of @ref CO_ODinterface
+ *
+ * Possible flags, can be ORed:
+ * - CO_CONFIG_OD_PROFILE - Enable read and write counters for each OD entry, see @ref CO_ODprofile.
+ *   Counters are started by OD_profileInit().
+ * - CO_CONFIG_OD_ARRAY_DOMAIN - Enable upload of the whole OD array as single domain, see @ref CO_ODarrayDomain.
+ */
+#ifdef CO_DOXYGEN
+#define CO_CONFIG_OD (0)
+#endif
+#define CO_CONFIG_OD_PROFILE      0x01
+#define CO_CONFIG_OD_ARRAY_DOMAIN 0x02
+
+/**
+ * Maximum rank of the OD entry, which can be selected in OD profile record.
+ *
+ * Used with CO_CONFIG_OD_PROFILE, see OD_profileObj_init(). OD profile object
+ * contains array of pointers of this size.
+ */
+#ifdef CO_DOXYGEN
+#define CO_CONFIG_OD_PROFILE_TOP_COUNT 10
+#endif
+/** @} */ /* CO_STACK_CONFIG_OD */
+
 /**
  * @defgroup CO_STACK_CONFIG_NMT_HB NMT master/slave and HB producer/consumer
  * Specified in standard CiA 301
@@ -344,6 +373,25 @@ extern "C" {
  * - CO_CONFIG_SDO_SRV_SEGMENTED - Enable SDO server segmented transfer.
  * - CO_CONFIG_SDO_SRV_BLOCK - Enable SDO server block transfer. If set, then
  *   CO_CONFIG_SDO_SRV_SEGMENTED must also be set.
+ * - CO_CONFIG_SDO_SRV_BLOCK_DIRECT - In block upload transfer data directly
+ *   from the original location of OD variable, if variable has known size, no
+ *   IO extension and is larger than #CO_CONFIG_SDO_SRV_BUFFER_SIZE. CRC is then
+ *   calculated over all data at once, at the start of transfer, and segments
+ *   are copied from the variable later. So application must not change, resize
+ *   or move data of the variable during block upload, otherwise client receives
+ *   data with wrong CRC. Interim buffer is used for other variables. If set,
+ *   then CO_CONFIG_SDO_SRV_BLOCK must also be set.
+ * - CO_CONFIG_SDO_SRV_BLOCK_ADAPTIVE - Adapt block size in block download to
+ *   lost segments and sub-block reception time, see CO_SDO_blockSizeAdapt().
+ *   Collect statistics of each block transfer in CO_SDOserver_t.block_stats.
+ *   If set, then CO_CONFIG_SDO_SRV_BLOCK must also be set.
+ * - CO_CONFIG_SDO_SRV_BUFFER_POOL - SDO server has no own interim buffer of
+ *   #CO_CONFIG_SDO_SRV_BUFFER_SIZE bytes. Instead it leases a buffer from the
+ *   pool, shared by many SDO servers, when segmented or block transfer starts
+ *   and returns it after the end of transfer. Expedited transfers and upload of
+ *   variables up to 7 bytes use small buffer inside the SDO server object. Pool
+ *   is configured by CO_SDOserver_bufPoolInit() and CO_SDOserver_initBufPool().
+ *   If set, then CO_CONFIG_SDO_SRV_SEGMENTED must also be set.
  * - #CO_CONFIG_FLAG_CALLBACK_PRE - Enable custom callback after preprocessing
  *   received SDO CANopen message.
  *   Callback is configured by CO_SDOserver_initCallbackPre().
@@ -357,20 +405,63 @@ extern "C" {
     (CO_CONFIG_SDO_SRV_SEGMENTED | CO_CONFIG_GLOBAL_FLAG_CALLBACK_PRE | CO_CONFIG_GLOBAL_FLAG_TIMERNEXT                \
      | CO_CONFIG_GLOBAL_FLAG_OD_DYNAMIC)
 #endif
-#define CO_CONFIG_SDO_SRV_SEGMENTED 0x02
-#define CO_CONFIG_SDO_SRV_BLOCK     0x04
+#define CO_CONFIG_SDO_SRV_SEGMENTED      0x02
+#define CO_CONFIG_SDO_SRV_BLOCK          0x04
+#define CO_CONFIG_SDO_SRV_BLOCK_DIRECT   0x08
+#define CO_CONFIG_SDO_SRV_BLOCK_ADAPTIVE 0x10
+#define CO_CONFIG_SDO_SRV_BUFFER_POOL    0x20
 
 /**
  * Size of the internal data buffer for the SDO server.
  *
  * If size is less than size of some variables in Object Dictionary, then data
  * will be transferred to internal buffer in several segments. Minimum size is
- * 8 or 899 (127*7) for block transfer.
+ * 8 or 899 (127*7) for block transfer. With CO_CONFIG_SDO_SRV_BUFFER_POOL this
+ * is size of each buffer in the pool.
  */
 #ifdef CO_DOXYGEN
 #define CO_CONFIG_SDO_SRV_BUFFER_SIZE 32
 #endif
 
+/**
+ * Number of buffers in the SDO server buffer pool, created by CO_new()
+ *
+ * Used with CO_CONFIG_SDO_SRV_BUFFER_POOL, 1 to 32. It is the maximum number
+ * of SDO servers, which can have segmented or block transfer in progress at
+ * the same time. Other such transfers are aborted with CO_SDO_AB_NO_RESOURCE.
+ */
+#ifdef CO_DOXYGEN
+#define CO_CONFIG_SDO_SRV_BUFFER_POOL_COUNT 1
+#endif
+
+/**
+ * Number of segments sent by one #CO_SDOserver_process() call in block upload
+ *
+ * If SDO server has block upload in progress and CAN transmit buffer is still
+ * free after the segment was sent (driver or OS has buffer for CAN tx frames),
+ * then next segment is sent within the same call, up to this number of
+ * segments (up to 127). So block upload is not limited by the frequency of
+ * #CO_SDOserver_process() calls. Sub-block ends the loop.
+ */
+#ifdef CO_DOXYGEN
+#define CO_CONFIG_SDO_SRV_BLOCK_UL_LOOP 1
+#endif
+
+/**
+ * Depth of the receive queue for the SDO server
+ *
+ * If 0, SDO server has space for one received frame. Next frame, received
+ * before the previous was processed by #CO_SDOserver_process(), is lost. If
+ * larger than 0 (up to 255), received frames are queued, so no frames are lost,
+ * if client sends a request before the previous is processed, for example
+ * abort followed by a new initiate, or if mainline processing is delayed.
+ * Frames received before abort from client are skipped. Block download
+ * segments are copied directly and do not use the queue.
+ */
+#ifdef CO_DOXYGEN
+#define CO_CONFIG_SDO_SRV_RX_QUEUE_SIZE 0
+#endif
+
 /**
  * Configuration of @ref CO_SDOclient
  *
@@ -383,6 +474,10 @@ extern "C" {
  * - CO_CONFIG_SDO_CLI_LOCAL - Enable local transfer, if Node-ID of the SDO
  *   server is the same as node-ID of the SDO client. (SDO client is the same
  *   device as SDO server.) Transfer data directly without communication on CAN.
+ * - CO_CONFIG_SDO_CLI_BLOCK_ADAPTIVE - Adapt block size in block upload to
+ *   lost segments and sub-block reception time, see CO_SDO_blockSizeAdapt().
+ *   Collect statistics of each block transfer in CO_SDOclient_t.block_stats.
+ *   If set, then CO_CONFIG_SDO_CLI_BLOCK must also be set.
  * - #CO_CONFIG_FLAG_CALLBACK_PRE - Enable custom callback after preprocessing
  *   received SDO CANopen message.
  *   Callback is configured by CO_SDOclient_initCallbackPre().
@@ -395,10 +490,11 @@ extern "C" {
 #ifdef CO_DOXYGEN
 #define CO_CONFIG_SDO_CLI (0)
 #endif
-#define CO_CONFIG_SDO_CLI_ENABLE    0x01
-#define CO_CONFIG_SDO_CLI_SEGMENTED 0x02
-#define CO_CONFIG_SDO_CLI_BLOCK     0x04
-#define CO_CONFIG_SDO_CLI_LOCAL     0x08
+#define CO_CONFIG_SDO_CLI_ENABLE         0x01
+#define CO_CONFIG_SDO_CLI_SEGMENTED      0x02
+#define CO_CONFIG_SDO_CLI_BLOCK          0x04
+#define CO_CONFIG_SDO_CLI_LOCAL          0x08
+#define CO_CONFIG_SDO_CLI_BLOCK_ADAPTIVE 0x10
 
 /**
  * Size of the internal data buffer for the SDO client.
@@ -481,12 +577,55 @@ extern "C" {
  *   function access with @ref OD_IO_t. This option enables much more
  *   flexibility for application program, but consumes some additional memory
  *   and processor resources. If this option is not enabled, then data from OD
- *   variables are fetched directly from memory allocated by Object dictionary.
+ *   variables are fetched directly from memory allocated by Object dictionary,
+ *   with one memcpy() per mapped entry, see @ref CO_PDO_directMap_t.
  * - CO_CONFIG_PDO_BITWISE_MAPPING - Use bitwise mapping instead of byte-wise
  *   By default, the OD_IO structure contains the number of bytes mapped to
  *   the PDO in the OD_IO.dataOffset field. If the bitwise mapping is enabled,
- *   this field stores the number of bits mapped to the PDO. Bitwise PDO mapping
- *   is not possible without CO_CONFIG_PDO_OD_IO_ACCESS
+ *   this field stores the number of bits mapped to the PDO. Without
+ *   CO_CONFIG_PDO_OD_IO_ACCESS bitwise mapping is used with direct access.
+ * - CO_CONFIG_PDO_COPY_PLAN - Compile PDO mapping into copy plan, see
+ *   @ref CO_PDO_copyRun_t. Mapped OD variables without IO extension are copied
+ *   directly with memcpy(), adjacent variables are merged into single copy.
+ *   OD_IO read()/write() is used only for variables with IO extension.
+ *   Together with CO_CONFIG_PDO_BITWISE_MAPPING shift and mask of each mapped
+ *   entry are precalculated instead. Requires CO_CONFIG_PDO_OD_IO_ACCESS.
+ * - CO_CONFIG_TPDO_COS - Enable change of value (COS) transmission of event
+ *   driven TPDOs, see @ref CO_TPDO_setCOS(). TPDO is sent only, if its data
+ *   differs from last transmitted data or if any mapped entry is outside its
+ *   deadband. Requires CO_CONFIG_TPDO_TIMERS_ENABLE.
+ * - CO_CONFIG_PDO_MPDO - Enable multiplexed PDOs (MPDO) in source address
+ *   mode (SAM) and destination address mode (DAM). PDO is MPDO, if its
+ *   mapping parameter, sub-index 0 is 0xFE (SAM) or 0xFF (DAM). See
+ *   @ref CO_TPDO_initMPDO(), @ref CO_RPDO_initMPDO() and
+ *   @ref CO_MPDO_dispatcher_init(). Requires CO_CONFIG_PDO_OD_IO_ACCESS.
+ * - CO_CONFIG_RPDO_READY_LIST - RPDOs, which received new data, are put into
+ *   the ready list from the CAN receive function. Only RPDOs from the list
+ *   are processed and RPDO timeouts are monitored by deadlines, see
+ *   @ref CO_RPDO_processReadyList(). Processing time depends on number of
+ *   received RPDOs and not on number of configured RPDOs.
+ * - CO_CONFIG_RPDO_RX_QUEUE - Enable optional receive queue of asynchronous
+ *   RPDOs, configured by @ref CO_RPDO_initRxQueue(). All received RPDOs
+ *   are stored, so none is lost, if multiple RPDOs are received between
+ *   two processing calls. Also counts overruns of RPDO receive buffers.
+ * - CO_CONFIG_TPDO_SYNC_BALANCE - Enable phase balancing of cyclic
+ *   synchronous TPDOs, see @ref CO_TPDO_balanceSync() and
+ *   @ref CO_PDO_syncBalance(). Requires CO_CONFIG_PDO_SYNC_ENABLE.
+ * - CO_CONFIG_TPDO_LATENCY - Enable latency measurement of synchronous TPDOs,
+ *   time from SYNC to CO_CANsend() and to transmission complete, see
+ *   @ref CO_TPDO_latency_t. Requires CO_CONFIG_PDO_SYNC_ENABLE.
+ * - CO_CONFIG_PDO_STAGED_MAPPING - Enable staged PDO mapping, see
+ *   @ref CO_RPDO_stageMapping() and @ref CO_TPDO_stageMapping(). New mapping
+ *   and CAN-ID of enabled PDO are prepared in advance and swapped in at SYNC,
+ *   without disabling the PDO. Requires CO_CONFIG_PDO_OD_IO_ACCESS and
+ *   #CO_CONFIG_FLAG_OD_DYNAMIC.
+ * - CO_CONFIG_PDO_COLD_SPLIT - Move data of each PDO, which is not needed for
+ *   processing of idle PDO (OD interface of mapped entries and dynamic
+ *   configuration), from CO_PDO_common_t into separate @ref CO_PDO_cold_t,
+ *   given to CO_RPDO_init() and CO_TPDO_init(). RPDO and TPDO objects become
+ *   several times smaller, so processing of many mostly idle PDOs touches less
+ *   memory. OD interface is still used on each received or transmitted PDO.
+ *   Requires CO_CONFIG_PDO_OD_IO_ACCESS.
  * - #CO_CONFIG_FLAG_CALLBACK_PRE - Enable custom callback after preprocessing
  *   received RPDO CANopen message.
  *   Callback is configured by CO_RPDO_initCallbackPre().
@@ -507,6 +646,15 @@ extern "C" {
 #define CO_CONFIG_PDO_SYNC_ENABLE        0x10
 #define CO_CONFIG_PDO_OD_IO_ACCESS       0x20
 #define CO_CONFIG_PDO_BITWISE_MAPPING    0x40
+#define CO_CONFIG_PDO_COPY_PLAN          0x80
+#define CO_CONFIG_TPDO_COS               0x100
+#define CO_CONFIG_PDO_MPDO               0x200
+#define CO_CONFIG_RPDO_READY_LIST        0x400
+#define CO_CONFIG_RPDO_RX_QUEUE          0x800
+#define CO_CONFIG_TPDO_SYNC_BALANCE      0x8000
+#define CO_CONFIG_TPDO_LATENCY           0x10000
+#define CO_CONFIG_PDO_STAGED_MAPPING     0x20000
+#define CO_CONFIG_PDO_COLD_SPLIT         0x40000
 /** @} */ /* CO_STACK_CONFIG_SYNC_PDO */
 
 /**
@@ -646,19 +794,26 @@ extern "C" {
  *   help usage.
  * - CO_CONFIG_GTW_ASCII_PRINT_LEDS - Display "red" and "green" CANopen status
  *   LED diodes on terminal.
+ * - CO_CONFIG_GTW_ASCII_PRINT_ODPROF - use non-standard command "_odprof" to
+ *   print most accessed OD entries. CO_CONFIG_OD_PROFILE must also be set.
+ * - CO_CONFIG_GTW_ASCII_PRINT_PDOLAT - use non-standard command "_pdolat" to
+ *   print latency statistics of synchronous TPDOs. CO_CONFIG_TPDO_LATENCY
+ *   must also be set.
  */
 #ifdef CO_DOXYGEN
 #define CO_CONFIG_GTW (0)
 #endif
-#define CO_CONFIG_GTW_MULTI_NET        0x01
-#define CO_CONFIG_GTW_ASCII            0x02
-#define CO_CONFIG_GTW_ASCII_SDO        0x04
-#define CO_CONFIG_GTW_ASCII_NMT        0x08
-#define CO_CONFIG_GTW_ASCII_LSS        0x10
-#define CO_CONFIG_GTW_ASCII_LOG        0x20
-#define CO_CONFIG_GTW_ASCII_ERROR_DESC 0x40
-#define CO_CONFIG_GTW_ASCII_PRINT_HELP 0x80
-#define CO_CONFIG_GTW_ASCII_PRINT_LEDS 0x100
+#define CO_CONFIG_GTW_MULTI_NET          0x01
+#define CO_CONFIG_GTW_ASCII              0x02
+#define CO_CONFIG_GTW_ASCII_SDO          0x04
+#define CO_CONFIG_GTW_ASCII_NMT          0x08
+#define CO_CONFIG_GTW_ASCII_LSS          0x10
+#define CO_CONFIG_GTW_ASCII_LOG          0x20
+#define CO_CONFIG_GTW_ASCII_ERROR_DESC   0x40
+#define CO_CONFIG_GTW_ASCII_PRINT_HELP   0x80
+#define CO_CONFIG_GTW_ASCII_PRINT_LEDS   0x100
+#define CO_CONFIG_GTW_ASCII_PRINT_ODPROF 0x200
+#define CO_CONFIG_GTW_ASCII_PRINT_PDOLAT 0x400
 
 /**
  * Number of loops of #CO_SDOclientDownload() in case of block download
@@ -687,6 +842,16 @@ extern "C" {
 #ifdef CO_DOXYGEN
 #define CO_CONFIG_GTWA_LOG_BUF_SIZE 2000
 #endif
+
+/**
+ * Maximum number of OD entries printed by command "_odprof" in ASCII gateway.
+ *
+ * Used with CO_CONFIG_GTW_ASCII_PRINT_ODPROF. It is also default number of
+ * printed entries. Gateway object contains array of pointers of this size.
+ */
+#ifdef CO_DOXYGEN
+#define CO_CONFIG_GTWA_ODPROF_COUNT 10
+#endif
 /** @} */ /* CO_STACK_CONFIG_GATEWAY */
 
 /**
@@ -699,13 +864,24 @@ extern "C" {
  *
  * Possible flags, can be ORed:
  * - CO_CONFIG_CRC16_ENABLE - Enable CRC16 calculation
- * - CO_CONFIG_CRC16_EXTERNAL - CRC functions are defined externally
+ * - CO_CONFIG_CRC16_EXTERNAL - CRC functions are defined externally, for
+ *   example with CRC hardware unit or with target specific instructions.
+ * - CO_CONFIG_CRC16_SLICE4 - crc16_ccitt() processes four bytes at once, using
+ *   three additional tables (1536 bytes of constant data).
+ * - CO_CONFIG_CRC16_SLICE8 - crc16_ccitt() processes eight bytes at once,
+ *   using seven additional tables (3584 bytes of constant data). If set, then
+ *   CO_CONFIG_CRC16_SLICE4 is ignored.
+ *
+ * Results are the same for all variants. Faster variants are useful for large
+ * data, for example in SDO block transfer or in data storage.
  */
 #ifdef CO_DOXYGEN
 #define CO_CONFIG_CRC16 (0)
 #endif
 #define CO_CONFIG_CRC16_ENABLE   0x01
 #define CO_CONFIG_CRC16_EXTERNAL 0x02
+#define CO_CONFIG_CRC16_SLICE4   0x04
+#define CO_CONFIG_CRC16_SLICE8   0x08
 /** @} */ /* CO_STACK_CONFIG_CRC16 */
 
 /**
@@ -764,6 +940,75 @@ extern "C" {
 #define CO_CONFIG_TRACE_OWN_INTTYPES 0x02
 /** @} */ /* CO_STACK_CONFIG_TRACE */
 
+/**
+ * @defgroup CO_STACK_CONFIG_PDO_ROUTER PDO router
+ * Non standard object
+ * @{
+ */
+/**
+ * Configuration of @ref CO_PDOrouter for forwarding PDOs between two CAN modules.
+ *
+ * Possible flags, can be ORed:
+ * - CO_CONFIG_PDO_ROUTER_ENABLE - Enable PDO router
+ * - #CO_CONFIG_FLAG_TIMERNEXT - Enable calculation of timerNext_us variable
+ *   inside CO_PDOrouter_process().
+ */
+#ifdef CO_DOXYGEN
+#define CO_CONFIG_PDO_ROUTER (0)
+#endif
+#define CO_CONFIG_PDO_ROUTER_ENABLE 0x01
+/** @} */ /* CO_STACK_CONFIG_PDO_ROUTER */
+
+/**
+ * @defgroup CO_STACK_CONFIG_SDO_QUEUE SDO request queue
+ * Non standard object
+ * @{
+ */
+/**
+ * Configuration of @ref CO_SDOqueue for multiplexing SDO requests over SDO client channels.
+ *
+ * Possible flags, can be ORed:
+ * - CO_CONFIG_SDO_QUEUE_ENABLE - Enable SDO request queue. #CO_CONFIG_SDO_CLI_ENABLE must also be enabled.
+ *   timerNext_us is calculated by SDO clients, if #CO_CONFIG_FLAG_TIMERNEXT is set in #CO_CONFIG_SDO_CLI.
+ */
+#ifdef CO_DOXYGEN
+#define CO_CONFIG_SDO_QUEUE (0)
+#endif
+#define CO_CONFIG_SDO_QUEUE_ENABLE 0x01
+/** @} */ /* CO_STACK_CONFIG_SDO_QUEUE */
+
+/**
+ * @defgroup CO_STACK_CONFIG_CONCISE_DCF Concise DCF download
+ * Specified in standard CiA 302-3
+ * @{
+ */
+/**
+ * Configuration of @ref CO_conciseDCF for configuring remote node from concise DCF.
+ *
+ * Possible flags, can be ORed:
+ * - CO_CONFIG_CONCISE_DCF_ENABLE - Enable Concise DCF download. #CO_CONFIG_SDO_CLI_ENABLE must also be enabled.
+ *   timerNext_us is calculated by SDO client, if #CO_CONFIG_FLAG_TIMERNEXT is set in #CO_CONFIG_SDO_CLI.
+ */
+#ifdef CO_DOXYGEN
+#define CO_CONFIG_CONCISE_DCF (0)
+#endif
+#define CO_CONFIG_CONCISE_DCF_ENABLE 0x01
+
+/**
+ * Number of loops of #CO_SDOclientDownload() in case of block download
+ *
+ * If SDO client has block download in progress and OS has buffer for CAN tx
+ * frames, then #CO_SDOclientDownload() function can be called multiple
+ * times within own loop (up to 127). This can speed-up SDO block transfer.
+ * Block download into object 0x1F22 sends one segment per loop, so with small
+ * value it is slower than download of entries one by one. Default is 127, so
+ * whole sub-block can be sent within one CO_conciseDCF_process() call.
+ */
+#ifdef CO_DOXYGEN
+#define CO_CONFIG_CONCISE_DCF_BLOCK_DL_LOOP 127
+#endif
+/** @} */ /* CO_STACK_CONFIG_CONCISE_DCF */
+
 /**
  * @defgroup CO_STACK_CONFIG_DEBUG Debug messages
  * Messages from different parts of the stack.
@@ -308,12 +308,14 @@ typedef struct {
                            default data, always required. */
     uint8_t attr;       /**< Attribute from @ref CO_storage_attributes_t, always required. */
     void* storageModule; /**< Pointer to storage module, target system specific usage, required with @ref
-                            CO_storage_eeprom. */
-    uint16_t crc; /**< CRC checksum of the data stored in eeprom, set on store, required with @ref CO_storage_eeprom. */
+                            CO_storage_eeprom and @ref CO_storage_mmap. */
+    uint16_t crc; /**< CRC checksum of the data stored in eeprom, set on store, required with @ref CO_storage_eeprom and
+                     @ref CO_storage_mmap. */
     size_t eepromAddrSignature; /**< Address of entry signature inside eeprom, set by init, required with @ref
                                    CO_storage_eeprom. */
     size_t eepromAddr; /**< Address of data inside eeprom, set by init, required with @ref CO_storage_eeprom. */
-    size_t offset; /**< Offset of next byte being updated by automatic storage, required with @ref CO_storage_eeprom. */
+    size_t offset; /**< Offset of next byte being updated by automatic storage, required with @ref CO_storage_eeprom.
+                      Offset of the entry inside the file, set by init, required with @ref CO_storage_mmap. */
     void* additionalParameters; /**< Additional target specific parameters, optional. */
 } CO_storage_entry_t;
 
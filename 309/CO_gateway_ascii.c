@@ -119,6 +119,24 @@ CO_GTWA_initRead(CO_GTWA_t* gtwa,
     }
 }
 
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_PRINT_ODPROF) != 0
+void
+CO_GTWA_initODprofile(CO_GTWA_t* gtwa, OD_t* od) {
+    if (gtwa != NULL) {
+        gtwa->OD = od;
+    }
+}
+#endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_PRINT_ODPROF */
+
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_PRINT_PDOLAT) != 0
+void
+CO_GTWA_initPDOlatency(CO_GTWA_t* gtwa, CO_TPDO_latency_t* TPDOlatency) {
+    if (gtwa != NULL) {
+        gtwa->TPDOlatency = TPDOlatency;
+    }
+}
+#endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_PRINT_PDOLAT */
+
 #if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_LOG) != 0
 void
 CO_GTWA_log_print(CO_GTWA_t* gtwa, const char* message) {
@@ -160,6 +178,10 @@ static const char CO_GTWA_helpString[] =
     "help [datatype|lss]                      # Print this or datatype or lss help.\n"
     "led                                      # Print status LEDs of this device.\n"
     "log                                      # Print message log.\n"
+    "_odprof [<count>]                        # Print most accessed OD entries of\n"
+    "                                         # this device, non-standard.\n"
+    "_pdolat [<tpdo>]                         # Print latency of synchronous TPDOs\n"
+    "                                         # of this device, non-standard.\n"
     "\n"
     "Response:\n"
     "\"[\"<sequence>\"]\" OK | <value> |\n"
@@ -731,6 +753,12 @@ CO_GTWA_process(CO_GTWA_t* gtwa, bool_t enable, uint32_t timeDifference_us, uint
 #endif
 #if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_PRINT_LEDS) != 0
         bool_t tok_is_led = strcmp(tok, "led") == 0;
+#endif
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_PRINT_ODPROF) != 0
+        bool_t tok_is__odprof = strcmp(tok, "_odprof") == 0;
+#endif
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_PRINT_PDOLAT) != 0
+        bool_t tok_is__pdolat = strcmp(tok, "_pdolat") == 0;
 #endif
         /* set command - multiple sub commands */
         if (tok_is_set) {
@@ -1526,6 +1554,65 @@ CO_GTWA_process(CO_GTWA_t* gtwa, bool_t enable, uint32_t timeDifference_us, uint
         }
 #endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_PRINT_LEDS */
 
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_PRINT_ODPROF) != 0
+        /* Print most accessed OD entries, non-standard - '_odprof [<count>]' */
+        else if (tok_is__odprof) {
+            uint16_t count = CO_CONFIG_GTWA_ODPROF_COUNT;
+
+            if (gtwa->OD == NULL) {
+                respErrorCode = CO_GTWA_respErrorReqNotSupported;
+                err = true;
+                break;
+            }
+            if (closed == 0U) {
+                /* get value */
+                closed = 1U;
+                (void)CO_fifo_readToken(&gtwa->commFifo, tok, sizeof(tok), &closed, &err);
+                count = (uint16_t)getU32(tok, 1, CO_CONFIG_GTWA_ODPROF_COUNT, &err);
+                if (err) {
+                    break;
+                }
+            }
+
+            /* collect entries in one pass and continue with state machine */
+            gtwa->odProfRank = 0;
+            gtwa->odProfCount = OD_profileGetTopList(gtwa->OD, gtwa->odProfTop, count);
+            gtwa->state = CO_GTWA_ST_ODPROF;
+        }
+#endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_PRINT_ODPROF */
+
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_PRINT_PDOLAT) != 0
+        /* Print latency of synchronous TPDOs, non-standard - '_pdolat [<tpdo>]' */
+        else if (tok_is__pdolat) {
+            CO_TPDO_latency_t* lat = gtwa->TPDOlatency;
+
+            if ((lat == NULL) || (lat->TPDOs == NULL)) {
+                respErrorCode = CO_GTWA_respErrorReqNotSupported;
+                err = true;
+                break;
+            }
+            gtwa->pdoLatIndex = 0;
+            gtwa->pdoLatEnd = lat->TPDOcount;
+            gtwa->pdoLatAll = true;
+            if (closed == 0U) {
+                /* get value */
+                closed = 1U;
+                (void)CO_fifo_readToken(&gtwa->commFifo, tok, sizeof(tok), &closed, &err);
+                uint16_t tpdo = (uint16_t)getU32(tok, 1, lat->TPDOcount, &err);
+                if (err) {
+                    break;
+                }
+                gtwa->pdoLatIndex = tpdo - 1U;
+                gtwa->pdoLatEnd = tpdo;
+                gtwa->pdoLatAll = false;
+            }
+
+            /* continue with state machine */
+            gtwa->pdoLatTxComplete = false;
+            gtwa->state = CO_GTWA_ST_PDOLAT;
+        }
+#endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_PRINT_PDOLAT */
+
         /* Unrecognized command */
         else {
             respErrorCode = CO_GTWA_respErrorReqNotSupported;
@@ -1988,6 +2075,77 @@ CO_GTWA_process(CO_GTWA_t* gtwa, bool_t enable, uint32_t timeDifference_us, uint
             }
 #endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_PRINT_LEDS */
 
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_PRINT_ODPROF) != 0
+            /* print most accessed OD entries, one per line */
+            case CO_GTWA_ST_ODPROF: {
+                do {
+                    if (gtwa->odProfRank >= gtwa->odProfCount) {
+                        responseWithOK(gtwa);
+                        gtwa->state = CO_GTWA_ST_IDLE;
+                        break;
+                    }
+
+                    const OD_entry_t* entry = gtwa->odProfTop[gtwa->odProfRank];
+                    const OD_profile_t* profile = OD_profileGet(entry);
+                    gtwa->odProfRank++;
+                    gtwa->respBufCount = (size_t)snprintf(gtwa->respBuf, CO_GTWA_RESP_BUF_SIZE,
+                                                          "# %u: 0x%04X read=%" PRIu32 " write=%" PRIu32 "\n",
+                                                          gtwa->odProfRank, entry->index,
+                                                          (profile != NULL) ? profile->read : 0U,
+                                                          (profile != NULL) ? profile->write : 0U);
+                    (void)respBufTransfer(gtwa);
+                } while (gtwa->respHold == false);
+                break;
+            }
+#endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_PRINT_ODPROF */
+
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_PRINT_PDOLAT) != 0
+            /* print latency of synchronous TPDOs, two lines per TPDO */
+            case CO_GTWA_ST_PDOLAT: {
+                do {
+                    const CO_TPDO_t* TPDO = NULL;
+                    while ((TPDO == NULL) && (gtwa->pdoLatIndex < gtwa->pdoLatEnd)) {
+                        TPDO = &gtwa->TPDOlatency->TPDOs[gtwa->pdoLatIndex];
+                        /* If all are printed, skip TPDOs without samples */
+                        if (gtwa->pdoLatAll && (TPDO->latencySend.count == 0U)) {
+                            TPDO = NULL;
+                            gtwa->pdoLatIndex++;
+                        }
+                    }
+                    if (TPDO == NULL) {
+                        responseWithOK(gtwa);
+                        gtwa->state = CO_GTWA_ST_IDLE;
+                        break;
+                    }
+
+                    const CO_TPDO_latencyStat_t* stat = gtwa->pdoLatTxComplete ? &TPDO->latencyTxComplete
+                                                                               : &TPDO->latencySend;
+                    size_t len = (size_t)snprintf(gtwa->respBuf, CO_GTWA_RESP_BUF_SIZE,
+                                                  "# TPDO%u %s: n=%" PRIu32 " min=%" PRIu32 " max=%" PRIu32
+                                                  " late=%" PRIu32 " hist=",
+                                                  gtwa->pdoLatIndex + 1U, gtwa->pdoLatTxComplete ? "txc" : "send",
+                                                  stat->count, (stat->count > 0U) ? stat->min_us : 0U, stat->max_us,
+                                                  stat->late);
+                    if (len > (CO_GTWA_RESP_BUF_SIZE - 2U)) {
+                        len = CO_GTWA_RESP_BUF_SIZE - 2U;
+                    }
+                    for (uint8_t i = 0; (i < CO_TPDO_LATENCY_BINS) && (len < (CO_GTWA_RESP_BUF_SIZE - 12U)); i++) {
+                        len += (size_t)snprintf(&gtwa->respBuf[len], CO_GTWA_RESP_BUF_SIZE - len, "%s%" PRIu32,
+                                                (i > 0U) ? "," : "", stat->histogram[i]);
+                    }
+                    gtwa->respBuf[len] = '\n';
+                    gtwa->respBufCount = len + 1U;
+
+                    if (gtwa->pdoLatTxComplete) {
+                        gtwa->pdoLatIndex++;
+                    }
+                    gtwa->pdoLatTxComplete = !gtwa->pdoLatTxComplete;
+                    (void)respBufTransfer(gtwa);
+                } while (gtwa->respHold == false);
+                break;
+            }
+#endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_PRINT_PDOLAT */
+
             /* illegal state */
             default: {
                 respErrorCode = CO_GTWA_respErrorInternalState;
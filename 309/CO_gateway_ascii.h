@@ -26,6 +26,7 @@
 #include "301/CO_fifo.h"
 #include "301/CO_SDOclient.h"
 #include "301/CO_NMT_Heartbeat.h"
+#include "301/CO_PDO.h"
 #include "305/CO_LSSmaster.h"
 #include "303/CO_LEDs.h"
 
@@ -33,6 +34,15 @@
 #ifndef CO_CONFIG_GTW
 #define CO_CONFIG_GTW (0)
 #endif
+#ifndef CO_CONFIG_GTWA_ODPROF_COUNT
+#define CO_CONFIG_GTWA_ODPROF_COUNT 10U
+#endif
+
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_PRINT_PDOLAT) != 0
+#if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_LATENCY) == 0
+#error CO_CONFIG_TPDO_LATENCY must be enabled.
+#endif
+#endif
 
 #if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII) != 0) || defined CO_DOXYGEN
 
@@ -202,7 +212,9 @@ typedef enum {
     CO_GTWA_ST_LSS_ALLNODES = 0x31U,         /**< LSS 'lss_allnodes' */
     CO_GTWA_ST_LOG = 0x80U,                  /**< print message 'log' */
     CO_GTWA_ST_HELP = 0x81U,                 /**< print 'help' text */
-    CO_GTWA_ST_LED = 0x82U                   /**< print 'status' of the node */
+    CO_GTWA_ST_LED = 0x82U,                  /**< print 'status' of the node */
+    CO_GTWA_ST_ODPROF = 0x83U,               /**< print '_odprof', most accessed OD entries */
+    CO_GTWA_ST_PDOLAT = 0x84U                /**< print '_pdolat', latency of synchronous TPDOs */
 } CO_GTWA_state_t;
 
 #if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) != 0) || defined CO_DOXYGEN
@@ -294,6 +306,19 @@ typedef struct {
     CO_LEDs_t* LEDs; /**< CO_LEDs_t object for CANopen status LEDs imitation from CO_GTWA_init() */
     uint8_t ledStringPreviousIndex;
 #endif
+#if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_PRINT_ODPROF) != 0) || defined CO_DOXYGEN
+    OD_t* OD;                                           /**< Object Dictionary from CO_GTWA_initODprofile() */
+    OD_entry_t* odProfTop[CO_CONFIG_GTWA_ODPROF_COUNT]; /**< Most accessed OD entries, printed by '_odprof' */
+    uint16_t odProfRank;                                /**< Rank of the next OD entry printed by '_odprof' */
+    uint16_t odProfCount;                               /**< Number of OD entries in odProfTop */
+#endif
+#if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_PRINT_PDOLAT) != 0) || defined CO_DOXYGEN
+    CO_TPDO_latency_t* TPDOlatency; /**< TPDO latency object from CO_GTWA_initPDOlatency() */
+    uint16_t pdoLatIndex;           /**< Index of the next TPDO printed by '_pdolat' */
+    uint16_t pdoLatEnd;             /**< Index after the last TPDO printed by '_pdolat' */
+    bool_t pdoLatTxComplete;        /**< True, if next line printed by '_pdolat' is for transmission complete */
+    bool_t pdoLatAll;               /**< True, if '_pdolat' prints all TPDOs with samples */
+#endif
 } CO_GTWA_t;
 
 /**
@@ -341,6 +366,33 @@ void CO_GTWA_initRead(CO_GTWA_t* gtwa,
                       size_t (*readCallback)(void* object, const char* buf, size_t count, uint8_t* connectionOK),
                       void* readCallbackObject);
 
+#if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_PRINT_ODPROF) != 0) || defined CO_DOXYGEN
+/**
+ * Initialize Object Dictionary for non-standard command '_odprof' in Gateway-ascii object
+ *
+ * Command '_odprof [<count>]' prints most accessed entries of the Object Dictionary, see @ref CO_ODprofile. If OD is
+ * not initialized, command responds with error. Counters must be started with @ref OD_profileInit(), otherwise no
+ * entries are printed.
+ *
+ * @param gtwa This object
+ * @param od Object Dictionary of this device
+ */
+void CO_GTWA_initODprofile(CO_GTWA_t* gtwa, OD_t* od);
+#endif
+
+#if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_PRINT_PDOLAT) != 0) || defined CO_DOXYGEN
+/**
+ * Initialize TPDO latency object for non-standard command '_pdolat' in Gateway-ascii object
+ *
+ * Command '_pdolat [<tpdo>]' prints latency statistics of all synchronous TPDOs or of single TPDO (1 for the first
+ * TPDO), see @ref CO_TPDO_latency_t. If latency object is not initialized, command responds with error.
+ *
+ * @param gtwa This object
+ * @param TPDOlatency TPDO latency object
+ */
+void CO_GTWA_initPDOlatency(CO_GTWA_t* gtwa, CO_TPDO_latency_t* TPDOlatency);
+#endif
+
 /**
  * Get free write buffer space
  *
@@ -425,6 +425,11 @@ CO_new(CO_config_t* config, uint32_t* heapMemoryUsed) {
         ON_MULTI_OD(uint8_t TX_CNT_SDO_SRV = 0);
         if (CO_GET_CNT(SDO_SRV) > 0U) {
             CO_alloc_break_on_fail(co->SDOserver, CO_GET_CNT(SDO_SRV), sizeof(*co->SDOserver));
+#if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_BUFFER_POOL) != 0
+            CO_alloc_break_on_fail(co->SDOserverBufPool, 1U, sizeof(*co->SDOserverBufPool));
+            CO_alloc_break_on_fail(co->SDOserverBufs, CO_CONFIG_SDO_SRV_BUFFER_POOL_COUNT,
+                                   sizeof(*co->SDOserverBufs));
+#endif
             ON_MULTI_OD(RX_CNT_SDO_SRV = config->CNT_SDO_SRV);
             ON_MULTI_OD(TX_CNT_SDO_SRV = config->CNT_SDO_SRV);
         }
@@ -467,6 +472,14 @@ CO_new(CO_config_t* config, uint32_t* heapMemoryUsed) {
         ON_MULTI_OD(uint16_t RX_CNT_RPDO = 0);
         if (CO_GET_CNT(RPDO) > 0U) {
             CO_alloc_break_on_fail(co->RPDO, CO_GET_CNT(RPDO), sizeof(*co->RPDO));
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_COLD_SPLIT) != 0
+            CO_alloc_break_on_fail(co->RPDOcold, CO_GET_CNT(RPDO), sizeof(*co->RPDOcold));
+#endif
+#if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_READY_LIST) != 0
+            CO_alloc_break_on_fail(co->RPDOreadyList, 1U, sizeof(*co->RPDOreadyList));
+            CO_alloc_break_on_fail(co->RPDOreadyQueue, CO_GET_CNT(RPDO) + 1U, sizeof(*co->RPDOreadyQueue));
+            CO_alloc_break_on_fail(co->RPDOreadySyncPending, CO_GET_CNT(RPDO), sizeof(*co->RPDOreadySyncPending));
+#endif
             ON_MULTI_OD(RX_CNT_RPDO = config->CNT_RPDO);
         }
 #endif
@@ -475,6 +488,12 @@ CO_new(CO_config_t* config, uint32_t* heapMemoryUsed) {
         ON_MULTI_OD(uint16_t TX_CNT_TPDO = 0);
         if (CO_GET_CNT(TPDO) > 0U) {
             CO_alloc_break_on_fail(co->TPDO, CO_GET_CNT(TPDO), sizeof(*co->TPDO));
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_COLD_SPLIT) != 0
+            CO_alloc_break_on_fail(co->TPDOcold, CO_GET_CNT(TPDO), sizeof(*co->TPDOcold));
+#endif
+#if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_LATENCY) != 0
+            CO_alloc_break_on_fail(co->TPDOlatency, 1U, sizeof(*co->TPDOlatency));
+#endif
             ON_MULTI_OD(TX_CNT_TPDO = config->CNT_TPDO);
         }
 #endif
@@ -712,10 +731,24 @@ CO_delete(CO_t* co) {
 #endif
 
 #if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_ENABLE) != 0
+#if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_LATENCY) != 0
+    CO_free(co->TPDOlatency);
+#endif
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_COLD_SPLIT) != 0
+    CO_free(co->TPDOcold);
+#endif
     CO_free(co->TPDO);
 #endif
 
 #if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_ENABLE) != 0
+#if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_READY_LIST) != 0
+    CO_free(co->RPDOreadySyncPending);
+    CO_free(co->RPDOreadyQueue);
+    CO_free(co->RPDOreadyList);
+#endif
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_COLD_SPLIT) != 0
+    CO_free(co->RPDOcold);
+#endif
     CO_free(co->RPDO);
 #endif
 
@@ -732,6 +765,10 @@ CO_delete(CO_t* co) {
 #endif
 
     /* SDOserver */
+#if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_BUFFER_POOL) != 0
+    CO_free(co->SDOserverBufs);
+    CO_free(co->SDOserverBufPool);
+#endif
     CO_free(co->SDOserver);
 
     /* Emergency */
@@ -785,6 +822,10 @@ static CO_EM_t COO_EM;
 static CO_EM_fifo_t COO_EM_FIFO[CO_GET_CNT(ARR_1003) + 1U];
 #endif
 static CO_SDOserver_t COO_SDOserver[OD_CNT_SDO_SRV];
+#if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_BUFFER_POOL) != 0
+static CO_SDOserver_bufPool_t COO_SDOserverBufPool;
+static CO_SDOserver_buf_t COO_SDOserverBufs[CO_CONFIG_SDO_SRV_BUFFER_POOL_COUNT];
+#endif
 #if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_ENABLE) != 0
 static CO_SDOclient_t COO_SDOclient[OD_CNT_SDO_CLI];
 #endif
@@ -796,9 +837,23 @@ static CO_SYNC_t COO_SYNC;
 #endif
 #if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_ENABLE) != 0
 static CO_RPDO_t COO_RPDO[OD_CNT_RPDO];
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_COLD_SPLIT) != 0
+static CO_PDO_cold_t COO_RPDOcold[OD_CNT_RPDO];
+#endif
+#if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_READY_LIST) != 0
+static CO_RPDO_readyList_t COO_RPDOreadyList;
+static uint16_t COO_RPDOreadyQueue[OD_CNT_RPDO + 1];
+static uint16_t COO_RPDOreadySyncPending[OD_CNT_RPDO];
+#endif
 #endif
 #if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_ENABLE) != 0
 static CO_TPDO_t COO_TPDO[OD_CNT_TPDO];
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_COLD_SPLIT) != 0
+static CO_PDO_cold_t COO_TPDOcold[OD_CNT_TPDO];
+#endif
+#if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_LATENCY) != 0
+static CO_TPDO_latency_t COO_TPDOlatency;
+#endif
 #endif
 #if ((CO_CONFIG_LEDS)&CO_CONFIG_LEDS_ENABLE) != 0
 static CO_LEDs_t COO_LEDs;
@@ -855,6 +910,10 @@ CO_new(CO_config_t* config, uint32_t* heapMemoryUsed) {
     co->em_fifo = &COO_EM_FIFO[0];
 #endif
     co->SDOserver = &COO_SDOserver[0];
+#if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_BUFFER_POOL) != 0
+    co->SDOserverBufPool = &COO_SDOserverBufPool;
+    co->SDOserverBufs = &COO_SDOserverBufs[0];
+#endif
 #if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_ENABLE) != 0
     co->SDOclient = &COO_SDOclient[0];
 #endif
@@ -866,9 +925,23 @@ CO_new(CO_config_t* config, uint32_t* heapMemoryUsed) {
 #endif
 #if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_ENABLE) != 0
     co->RPDO = &COO_RPDO[0];
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_COLD_SPLIT) != 0
+    co->RPDOcold = &COO_RPDOcold[0];
+#endif
+#if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_READY_LIST) != 0
+    co->RPDOreadyList = &COO_RPDOreadyList;
+    co->RPDOreadyQueue = &COO_RPDOreadyQueue[0];
+    co->RPDOreadySyncPending = &COO_RPDOreadySyncPending[0];
+#endif
 #endif
 #if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_ENABLE) != 0
     co->TPDO = &COO_TPDO[0];
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_COLD_SPLIT) != 0
+    co->TPDOcold = &COO_TPDOcold[0];
+#endif
+#if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_LATENCY) != 0
+    co->TPDOlatency = &COO_TPDOlatency;
+#endif
 #endif
 #if ((CO_CONFIG_LEDS)&CO_CONFIG_LEDS_ENABLE) != 0
     co->LEDs = &COO_LEDs;
@@ -1079,6 +1152,12 @@ CO_CANopenInit(CO_t* co, CO_NMT_t* NMT, CO_EM_t* em, OD_t* od, OD_entry_t* OD_st
     /* SDOserver */
     if (CO_GET_CNT(SDO_SRV) > 0U) {
         OD_entry_t* SDOsrvPar = OD_GET(H1200, OD_H1200_SDO_SERVER_1_PARAM);
+#if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_BUFFER_POOL) != 0
+        err = CO_SDOserver_bufPoolInit(co->SDOserverBufPool, co->SDOserverBufs, CO_CONFIG_SDO_SRV_BUFFER_POOL_COUNT);
+        if (err != CO_ERROR_NO) {
+            return err;
+        }
+#endif
         for (uint16_t i = 0; i < CO_GET_CNT(SDO_SRV); i++) {
             err = CO_SDOserver_init(&co->SDOserver[i], od, SDOsrvPar, nodeId, SDOserverTimeoutTime_ms, co->CANmodule,
                                     CO_GET_CO(RX_IDX_SDO_SRV) + i, co->CANmodule, CO_GET_CO(TX_IDX_SDO_SRV) + i,
@@ -1086,6 +1165,9 @@ CO_CANopenInit(CO_t* co, CO_NMT_t* NMT, CO_EM_t* em, OD_t* od, OD_entry_t* OD_st
             if (err != CO_ERROR_NO) {
                 return err;
             }
+#if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_BUFFER_POOL) != 0
+            CO_SDOserver_initBufPool(&co->SDOserver[i], co->SDOserverBufPool);
+#endif
             SDOsrvPar++;
         }
     }
@@ -1162,6 +1244,14 @@ CO_CANopenInit(CO_t* co, CO_NMT_t* NMT, CO_EM_t* em, OD_t* od, OD_entry_t* OD_st
         if (err != CO_ERROR_NO) {
             return err;
         }
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_PRINT_ODPROF) != 0
+        CO_GTWA_initODprofile(co->gtwa, od);
+#endif
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_PRINT_PDOLAT) != 0
+        if (CO_GET_CNT(TPDO) > 0U) {
+            CO_GTWA_initPDOlatency(co->gtwa, co->TPDOlatency);
+        }
+#endif
     }
 #endif
 
@@ -1211,6 +1301,9 @@ CO_CANopenInitPDO(CO_t* co, CO_EM_t* em, OD_t* od, uint8_t nodeId, uint32_t* err
             err = CO_RPDO_init(&co->RPDO[i], od, em,
 #if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_SYNC_ENABLE) != 0
                                co->SYNC,
+#endif
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_COLD_SPLIT) != 0
+                               &co->RPDOcold[i],
 #endif
                                preDefinedCanId, RPDOcomm, RPDOmap, co->CANmodule, CO_GET_CO(RX_IDX_RPDO) + i, errInfo);
             if (err != CO_ERROR_NO) {
@@ -1219,6 +1312,13 @@ CO_CANopenInitPDO(CO_t* co, CO_EM_t* em, OD_t* od, uint8_t nodeId, uint32_t* err
             RPDOcomm++;
             RPDOmap++;
         }
+#if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_READY_LIST) != 0
+        CO_ReturnError_t err = CO_RPDO_readyList_init(co->RPDOreadyList, co->RPDO, CO_GET_CNT(RPDO),
+                                                      co->RPDOreadyQueue, co->RPDOreadySyncPending);
+        if (err != CO_ERROR_NO) {
+            return err;
+        }
+#endif
     }
 #endif
 
@@ -1241,6 +1341,9 @@ CO_CANopenInitPDO(CO_t* co, CO_EM_t* em, OD_t* od, uint8_t nodeId, uint32_t* err
             err = CO_TPDO_init(&co->TPDO[i], od, em,
 #if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_SYNC_ENABLE) != 0
                                co->SYNC,
+#endif
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_COLD_SPLIT) != 0
+                               &co->TPDOcold[i],
 #endif
                                preDefinedCanId, TPDOcomm, TPDOmap, co->CANmodule, CO_GET_CO(TX_IDX_TPDO) + i, errInfo);
             if (err != CO_ERROR_NO) {
@@ -1249,6 +1352,12 @@ CO_CANopenInitPDO(CO_t* co, CO_EM_t* em, OD_t* od, uint8_t nodeId, uint32_t* err
             TPDOcomm++;
             TPDOmap++;
         }
+#if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_LATENCY) != 0
+        CO_ReturnError_t err = CO_TPDO_latencyInit(co->TPDOlatency, co->TPDO, CO_GET_CNT(TPDO));
+        if (err != CO_ERROR_NO) {
+            return err;
+        }
+#endif
     }
 #endif
 
@@ -1443,6 +1552,15 @@ CO_process_RPDO(CO_t* co, bool_t syncWas, uint32_t timeDifference_us, uint32_t*
     bool_t anyTimeout = false;
 #endif
 
+#if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_READY_LIST) != 0
+    if (CO_GET_CNT(RPDO) > 0U) {
+        CO_RPDO_processReadyList(co->RPDOreadyList, co->RPDO,
+#if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_TIMERS_ENABLE) != 0
+                                 timeDifference_us, &anyTimeout, timerNext_us,
+#endif
+                                 NMTisOperational, syncWas);
+    }
+#else
     for (uint16_t i = 0; i < CO_GET_CNT(RPDO); i++) {
         CO_RPDO_process(&co->RPDO[i],
 #if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_TIMERS_ENABLE) != 0
@@ -1450,6 +1568,7 @@ CO_process_RPDO(CO_t* co, bool_t syncWas, uint32_t timeDifference_us, uint32_t*
 #endif
                         NMTisOperational, syncWas);
     }
+#endif
 
 #if ((CO_CONFIG_PDO)&CO_CONFIG_RPDO_TIMERS_ENABLE) != 0
     /* CO_EM_RPDO_TIME_OUT is a single shared bit for all RPDOs. Only reset it
@@ -1473,6 +1592,11 @@ CO_process_TPDO(CO_t* co, bool_t syncWas, uint32_t timeDifference_us, uint32_t*
 
     bool_t NMTisOperational = CO_NMT_getInternalState(co->NMT) == CO_NMT_OPERATIONAL;
 
+#if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_LATENCY) != 0
+    if (CO_GET_CNT(TPDO) > 0U) {
+        CO_TPDO_latencyProcess(co->TPDOlatency, syncWas);
+    }
+#endif
     for (uint16_t i = 0; i < CO_GET_CNT(TPDO); i++) {
         CO_TPDO_process(&co->TPDO[i],
 #if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_TIMERS_ENABLE) != 0
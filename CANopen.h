@@ -286,6 +286,10 @@ typedef struct {
     CO_EM_fifo_t* em_fifo; /**< FIFO for emergency object, initialised by @ref CO_EM_init() */
 #endif
     CO_SDOserver_t* SDOserver; /**< SDO server objects, initialised by @ref CO_SDOserver_init() */
+#if (((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_BUFFER_POOL) != 0) || defined CO_DOXYGEN
+    CO_SDOserver_bufPool_t* SDOserverBufPool; /**< Buffer pool shared by SDO servers, @ref CO_SDOserver_bufPoolInit() */
+    CO_SDOserver_buf_t* SDOserverBufs;        /**< #CO_CONFIG_SDO_SRV_BUFFER_POOL_COUNT buffers of SDOserverBufPool */
+#endif
 #if defined CO_MULTIPLE_OD || defined CO_DOXYGEN
     uint16_t RX_IDX_SDO_SRV; /**< Start index in CANrx. */
     uint16_t TX_IDX_SDO_SRV; /**< Start index in CANtx. */
@@ -313,12 +317,28 @@ typedef struct {
 #endif
 #if (((CO_CONFIG_PDO)&CO_CONFIG_RPDO_ENABLE) != 0) || defined CO_DOXYGEN
     CO_RPDO_t* RPDO; /**< RPDO objects, initialised by @ref CO_RPDO_init() */
+#if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_COLD_SPLIT) != 0) || defined CO_DOXYGEN
+    CO_PDO_cold_t* RPDOcold; /**< Data of RPDO objects, not needed by idle RPDO, same number as RPDOs */
+#endif
+#if (((CO_CONFIG_PDO)&CO_CONFIG_RPDO_READY_LIST) != 0) || defined CO_DOXYGEN
+    CO_RPDO_readyList_t* RPDOreadyList; /**< List of RPDOs with new data, initialised by
+                                           @ref CO_RPDO_readyList_init() */
+    uint16_t* RPDOreadyQueue;           /**< Queue for RPDOreadyList, number of RPDOs + 1 */
+    uint16_t* RPDOreadySyncPending;     /**< Synchronous RPDOs for RPDOreadyList, number of RPDOs */
+#endif
 #if defined CO_MULTIPLE_OD || defined CO_DOXYGEN
     uint16_t RX_IDX_RPDO; /**< Start index in CANrx. */
 #endif
 #endif
 #if (((CO_CONFIG_PDO)&CO_CONFIG_TPDO_ENABLE) != 0) || defined CO_DOXYGEN
     CO_TPDO_t* TPDO; /**< TPDO objects, initialised by @ref CO_TPDO_init() */
+#if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_COLD_SPLIT) != 0) || defined CO_DOXYGEN
+    CO_PDO_cold_t* TPDOcold; /**< Data of TPDO objects, not needed by idle TPDO, same number as TPDOs */
+#endif
+#if (((CO_CONFIG_PDO)&CO_CONFIG_TPDO_LATENCY) != 0) || defined CO_DOXYGEN
+    CO_TPDO_latency_t* TPDOlatency; /**< Latency measurement of synchronous TPDOs, initialised by
+                                       @ref CO_TPDO_latencyInit() */
+#endif
 #if defined CO_MULTIPLE_OD || defined CO_DOXYGEN
     uint16_t TX_IDX_TPDO; /**< Start index in CANtx. */
 #endif
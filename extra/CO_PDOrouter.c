@@ -0,0 +1,172 @@
+/*
+ * CANopen PDO router, which forwards PDOs between two CAN modules.
+ *
+ * @file        CO_PDOrouter.c
+ * @ingroup     CO_PDOrouter
+ * @author      Janez Paternoster
+ * @copyright   2021 Janez Paternoster
+ *
+ * This file is part of <https://github.com/CANopenNode/CANopenNode>, a CANopen Stack.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ */
+
+#include <string.h>
+
+#include "extra/CO_PDOrouter.h"
+
+#if ((CO_CONFIG_PDO_ROUTER)&CO_CONFIG_PDO_ROUTER_ENABLE) != 0
+
+/*
+ * Copy data of received frame into data of forwarded frame, rearranged according to byteMap.
+ */
+static void
+CO_PDOrouter_copy(const CO_PDOrouteConfig_t* config, uint8_t* dst, const uint8_t* src) {
+    for (uint8_t i = 0; i < config->dstDLC; i++) {
+        uint8_t srcByte = (config->byteMap != NULL) ? config->byteMap[i] : i;
+        dst[i] = (srcByte == CO_PDO_ROUTE_BYTE_ZERO) ? 0U : src[srcByte];
+    }
+}
+
+/*
+ * Read received frame from source CAN module and forward it.
+ *
+ * Function will be called (by CAN receive interrupt) every time, when CAN frame with correct identifier
+ * will be received. For more information and description of parameters see file CO_driver.h.
+ */
+static void
+CO_PDOrouter_receive(void* object, void* msg) {
+    CO_PDOroute_t* route = object;
+    uint8_t DLC = CO_CANrxMsg_readDLC(msg);
+    const uint8_t* data = CO_CANrxMsg_readData(msg);
+
+    if (DLC < route->srcLength) {
+        route->dropped++;
+    } else if (route->config->inhibitTime_us > 0U) {
+        /* rate limited, keep only the last frame, it will be forwarded from CO_PDOrouter_process() */
+        if (CO_FLAG_READ(route->CANrxNew)) {
+            route->dropped++;
+        }
+        CO_PDOrouter_copy(route->config, route->pendingData, data);
+        CO_FLAG_SET(route->CANrxNew);
+    } else {
+        /* CANtxBuff of route without inhibit time is used only here */
+        CO_PDOrouter_copy(route->config, route->CANtxBuff->data, data);
+        (void)CO_CANsend(route->CANdevTx, route->CANtxBuff);
+        route->forwarded++;
+    }
+}
+
+CO_ReturnError_t
+CO_PDOrouter_init(CO_PDOrouter_t* router, CO_PDOroute_t routes[], const CO_PDOrouteConfig_t config[],
+                  uint16_t routesCount, CO_CANmodule_t* CANdevRx, uint16_t CANdevRxIdx, CO_CANmodule_t* CANdevTx,
+                  uint16_t CANdevTxIdx, uint32_t* errInfo) {
+    /* verify arguments */
+    if ((router == NULL) || (routes == NULL) || (config == NULL) || (CANdevRx == NULL) || (CANdevTx == NULL)) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
+
+    router->routes = routes;
+    router->routesCount = routesCount;
+
+    for (uint16_t i = 0; i < routesCount; i++) {
+        CO_PDOroute_t* route = &routes[i];
+        const CO_PDOrouteConfig_t* cfg = &config[i];
+        uint8_t srcLength = cfg->dstDLC;
+        bool_t cfgValid = (cfg->srcIdent <= 0x7FFU) && (cfg->dstIdent <= 0x7FFU) && (cfg->dstDLC <= 8U);
+
+        /* received frame must contain all bytes, referenced from byteMap */
+        if (cfgValid && (cfg->byteMap != NULL)) {
+            srcLength = 0;
+            for (uint8_t j = 0; j < cfg->dstDLC; j++) {
+                uint8_t srcByte = cfg->byteMap[j];
+                if (srcByte == CO_PDO_ROUTE_BYTE_ZERO) {
+                    /* byte of the forwarded frame is zero */
+                } else if (srcByte >= 8U) {
+                    cfgValid = false;
+                } else if (srcByte >= srcLength) {
+                    srcLength = srcByte + 1U;
+                } else { /* MISRA C 2004 14.10 */
+                }
+            }
+        }
+        if (!cfgValid) {
+            if (errInfo != NULL) {
+                *errInfo = i;
+            }
+            return CO_ERROR_ILLEGAL_ARGUMENT;
+        }
+
+        (void)memset(route, 0, sizeof(CO_PDOroute_t));
+        route->config = cfg;
+        route->CANdevTx = CANdevTx;
+        route->srcLength = srcLength;
+        CO_FLAG_CLEAR(route->CANrxNew);
+
+        route->CANtxBuff = CO_CANtxBufferInit(CANdevTx, CANdevTxIdx + i, cfg->dstIdent, false, cfg->dstDLC, false);
+        if (route->CANtxBuff == NULL) {
+            if (errInfo != NULL) {
+                *errInfo = i;
+            }
+            return CO_ERROR_ILLEGAL_ARGUMENT;
+        }
+
+        CO_ReturnError_t ret = CO_CANrxBufferInit(CANdevRx, CANdevRxIdx + i, cfg->srcIdent, 0x7FF, false, (void*)route,
+                                                  CO_PDOrouter_receive);
+        if (ret != CO_ERROR_NO) {
+            if (errInfo != NULL) {
+                *errInfo = i;
+            }
+            return ret;
+        }
+    }
+
+    return CO_ERROR_NO;
+}
+
+void
+CO_PDOrouter_process(CO_PDOrouter_t* router, uint32_t timeDifference_us, uint32_t* timerNext_us) {
+    (void)timerNext_us; /* may be unused */
+
+    for (uint16_t i = 0; i < router->routesCount; i++) {
+        CO_PDOroute_t* route = &router->routes[i];
+        uint32_t inhibitTime_us = route->config->inhibitTime_us;
+
+        if (inhibitTime_us == 0U) {
+            continue;
+        }
+
+        route->inhibitTimer = (route->inhibitTimer > timeDifference_us) ? (route->inhibitTimer - timeDifference_us)
+                                                                        : 0U;
+
+        if ((route->inhibitTimer == 0U) && CO_FLAG_READ(route->CANrxNew)) {
+            /* Clear the flag. If between the copy operation CANrxNew is set by receive callback, copy again, so
+             * consistent data of the last frame are forwarded. CANtxBuff of rate limited route is used only here. */
+            do {
+                CO_FLAG_CLEAR(route->CANrxNew);
+                (void)memcpy(route->CANtxBuff->data, route->pendingData, route->config->dstDLC);
+            } while (CO_FLAG_READ(route->CANrxNew));
+
+            /* forward the frame and start inhibit time */
+            (void)CO_CANsend(route->CANdevTx, route->CANtxBuff);
+            route->delayed++;
+            route->inhibitTimer = inhibitTime_us;
+        }
+
+#if ((CO_CONFIG_PDO_ROUTER)&CO_CONFIG_FLAG_TIMERNEXT) != 0
+        if ((route->inhibitTimer > 0U) && (timerNext_us != NULL) && (*timerNext_us > route->inhibitTimer)) {
+            /* Schedule for just beyond inhibit window */
+            *timerNext_us = route->inhibitTimer;
+        }
+#endif
+    }
+}
+
+#endif /* (CO_CONFIG_PDO_ROUTER) & CO_CONFIG_PDO_ROUTER_ENABLE */
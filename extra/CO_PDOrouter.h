@@ -0,0 +1,142 @@
+/**
+ * CANopen PDO router, which forwards PDOs between two CAN modules.
+ *
+ * @file        CO_PDOrouter.h
+ * @ingroup     CO_PDOrouter
+ * @author      Janez Paternoster
+ * @copyright   2021 Janez Paternoster
+ *
+ * This file is part of <https://github.com/CANopenNode/CANopenNode>, a CANopen Stack.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ */
+
+#ifndef CO_PDO_ROUTER_H
+#define CO_PDO_ROUTER_H
+
+#include "301/CO_driver.h"
+
+/* default configuration, see CO_config.h */
+#ifndef CO_CONFIG_PDO_ROUTER
+#define CO_CONFIG_PDO_ROUTER (0)
+#endif
+
+#if (((CO_CONFIG_PDO_ROUTER)&CO_CONFIG_PDO_ROUTER_ENABLE) != 0) || defined CO_DOXYGEN
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup CO_PDOrouter PDO router
+ * CANopen PDO router, which forwards PDOs between two CAN modules.
+ *
+ * @ingroup CO_CANopen_extra
+ * @{
+ * PDO router bridges two CAN networks, for example on a device with two CAN interfaces. Routing table is an array of
+ * @ref CO_PDOrouteConfig_t, defined by application. Each route forwards CAN frames with one CAN identifier from the
+ * source CAN module to the destination CAN module, optionally with different CAN identifier and rearranged data bytes.
+ * PDOs are not copied into Object Dictionary, and RPDO and TPDO objects are not involved.
+ *
+ * Route without inhibit time forwards the frame directly from the CAN receive callback (inside CAN receive interrupt or
+ * thread), so there is no latency of the CO_process() loop. For that CO_CANsend() on destination CAN module must be
+ * callable from CAN receive callback of the source CAN module, see @ref CO_critical_sections.
+ *
+ * Route may be rate limited with inhibit time. Such route works like event driven TPDO with inhibit time: receive
+ * callback only stores the frame and CO_PDOrouter_process() forwards it and starts the inhibit time. Frames received
+ * within the inhibit time are not forwarded immediately, only the last of them is kept and it is forwarded after the
+ * inhibit time expires. So transmit buffer of each route is written from one context only. Frames are routed in one
+ * direction, for the other direction use another router object.
+ */
+
+/** Value in @ref CO_PDOrouteConfig_t byteMap, which sets byte of the forwarded frame to zero */
+#define CO_PDO_ROUTE_BYTE_ZERO 0xFFU
+
+/**
+ * Configuration of one route, part of routing table.
+ */
+typedef struct {
+    uint16_t srcIdent;       /**< 11-bit CAN identifier of the frame received on source CAN module */
+    uint16_t dstIdent;       /**< 11-bit CAN identifier of the forwarded frame on destination CAN module */
+    uint8_t dstDLC;          /**< Data length of the forwarded frame, 0 to 8 */
+    const uint8_t* byteMap;  /**< Array of dstDLC bytes or NULL. Byte i of the forwarded frame is byte byteMap[i] of
+                                the received frame or zero for @ref CO_PDO_ROUTE_BYTE_ZERO. If NULL, first dstDLC bytes
+                                are copied unchanged. */
+    uint32_t inhibitTime_us; /**< Minimum time between two forwarded frames in microseconds, 0 for no limit */
+} CO_PDOrouteConfig_t;
+
+/**
+ * Route object, one for each entry in routing table.
+ */
+typedef struct {
+    const CO_PDOrouteConfig_t* config; /**< From CO_PDOrouter_init() */
+    CO_CANmodule_t* CANdevTx;          /**< From CO_PDOrouter_init() */
+    CO_CANtx_t* CANtxBuff;             /**< CAN transmit buffer inside CANdevTx */
+    uint8_t srcLength;                 /**< Minimum data length of received frame, calculated from byteMap */
+    uint32_t inhibitTimer;             /**< Inhibit timer in microseconds, started when frame is forwarded */
+    volatile void* CANrxNew;           /**< Variable indicates, if rate limited frame is waiting in pendingData */
+    uint8_t pendingData[8];            /**< Data of rate limited frame, already rearranged */
+    uint32_t forwarded;                /**< Number of frames forwarded directly from receive callback */
+    uint32_t delayed;                  /**< Number of rate limited frames, forwarded from CO_PDOrouter_process() */
+    uint32_t dropped; /**< Number of frames not forwarded: too short or rate limited and overwritten by newer one */
+} CO_PDOroute_t;
+
+/**
+ * PDO router object.
+ */
+typedef struct {
+    CO_PDOroute_t* routes; /**< From CO_PDOrouter_init() */
+    uint16_t routesCount;  /**< From CO_PDOrouter_init() */
+} CO_PDOrouter_t;
+
+/**
+ * Initialize PDO router.
+ *
+ * Function must be called in the communication reset section.
+ *
+ * @param router This object will be initialized.
+ * @param routes Array of routesCount route objects, defined by application.
+ * @param config Routing table, array of routesCount route configurations. It must exist during router lifetime.
+ * @param routesCount Number of routes.
+ * @param CANdevRx Source CAN module.
+ * @param CANdevRxIdx Index of the first receive buffer in the source CAN module. Each route uses own buffer, starting
+ * with this index.
+ * @param CANdevTx Destination CAN module.
+ * @param CANdevTxIdx Index of the first transmit buffer in the destination CAN module. Each route uses own buffer,
+ * starting with this index.
+ * @param [out] errInfo Index of erroneous route in case of CO_ERROR_ILLEGAL_ARGUMENT, may be NULL.
+ *
+ * @return #CO_ReturnError_t CO_ERROR_NO on success.
+ */
+CO_ReturnError_t CO_PDOrouter_init(CO_PDOrouter_t* router, CO_PDOroute_t routes[], const CO_PDOrouteConfig_t config[],
+                                   uint16_t routesCount, CO_CANmodule_t* CANdevRx, uint16_t CANdevRxIdx,
+                                   CO_CANmodule_t* CANdevTx, uint16_t CANdevTxIdx, uint32_t* errInfo);
+
+/**
+ * Process PDO router.
+ *
+ * Function must be called cyclically, for example after CAN reception. It forwards frames of rate limited routes and
+ * runs their inhibit timers. Routes without inhibit time are not processed here.
+ *
+ * @param router This object.
+ * @param timeDifference_us Time difference from previous function call in [microseconds].
+ * @param [out] timerNext_us info to OS - see CO_process().
+ */
+void CO_PDOrouter_process(CO_PDOrouter_t* router, uint32_t timeDifference_us, uint32_t* timerNext_us);
+
+/** @} */ /* CO_PDOrouter */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* (CO_CONFIG_PDO_ROUTER) & CO_CONFIG_PDO_ROUTER_ENABLE */
+
+#endif /* CO_PDO_ROUTER_H */
@@ -0,0 +1,284 @@
+/*
+ * CANopen SDO request queue, which multiplexes SDO transfers over SDO client channels.
+ *
+ * @file        CO_SDOqueue.c
+ * @ingroup     CO_SDOqueue
+ * @author      Janez Paternoster
+ * @copyright   2021 Janez Paternoster
+ *
+ * This file is part of <https://github.com/CANopenNode/CANopenNode>, a CANopen Stack.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ */
+
+#include "extra/CO_SDOqueue.h"
+
+#if ((CO_CONFIG_SDO_QUEUE)&CO_CONFIG_SDO_QUEUE_ENABLE) != 0
+
+/* verify configuration */
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_ENABLE) == 0
+#error CO_CONFIG_SDO_CLI_ENABLE must be enabled.
+#endif
+
+/*
+ * Finish the request: store the result, update statistics and call the callback.
+ */
+static void
+CO_SDOqueue_finish(CO_SDOqueue_t* queue, CO_SDOrequest_t* req, CO_SDO_return_t ret, CO_SDO_abortCode_t abortCode,
+                   size_t sizeTransferred) {
+    if ((ret < CO_SDO_RT_ok_communicationEnd) && (abortCode == CO_SDO_AB_NONE)) {
+        abortCode = CO_SDO_AB_GENERAL;
+    }
+    req->ret = ret;
+    req->abortCode = abortCode;
+    req->sizeTransferred = sizeTransferred;
+    req->state = CO_SDO_REQ_IDLE;
+
+    if (ret == CO_SDO_RT_ok_communicationEnd) {
+        queue->completed++;
+    } else {
+        queue->failed++;
+    }
+
+    if (req->callback != NULL) {
+        req->callback(req->object, req);
+    }
+}
+
+/*
+ * Verify, if transfer with SDO server node is in progress on any channel.
+ */
+static bool_t
+CO_SDOqueue_nodeBusy(const CO_SDOqueue_t* queue, uint8_t nodeId) {
+    for (uint8_t i = 0; i < queue->channelsCount; i++) {
+        const CO_SDOrequest_t* req = queue->channels[i].req;
+        if ((req != NULL) && (req->nodeId == nodeId)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+ * Start the first pending request to the node, which is not busy, on free channel.
+ *
+ * Requests, which can not be started, are finished with error. Returns true, if transfer was started.
+ */
+static bool_t
+CO_SDOqueue_startNext(CO_SDOqueue_t* queue, CO_SDOqueueChannel_t* ch) {
+    CO_SDOrequest_t* prev = NULL;
+    CO_SDOrequest_t* req = queue->first;
+
+    while (req != NULL) {
+        if (CO_SDOqueue_nodeBusy(queue, req->nodeId)) {
+            prev = req;
+            req = req->next;
+            continue;
+        }
+
+        /* remove the request from the list of pending requests */
+        if (prev == NULL) {
+            queue->first = req->next;
+        } else {
+            prev->next = req->next;
+        }
+        if (queue->last == req) {
+            queue->last = prev;
+        }
+        req->next = NULL;
+
+        /* configure the channel for the node and initiate the transfer */
+        CO_SDOclient_t* SDO_C = ch->SDO_C;
+        CO_SDO_return_t ret = CO_SDOclient_setup(SDO_C, CO_CAN_ID_SDO_CLI + (uint32_t)req->nodeId,
+                                                 CO_CAN_ID_SDO_SRV + (uint32_t)req->nodeId, req->nodeId);
+        if (ret == CO_SDO_RT_ok_communicationEnd) {
+            if (req->write) {
+                ret = CO_SDOclientDownloadInitiate(SDO_C, req->index, req->subIndex, req->bufSize, req->timeout_ms,
+                                                   req->blockEnable);
+            } else {
+                ret = CO_SDOclientUploadInitiate(SDO_C, req->index, req->subIndex, req->timeout_ms, req->blockEnable);
+            }
+        }
+
+        if (ret == CO_SDO_RT_ok_communicationEnd) {
+            req->state = CO_SDO_REQ_ACTIVE;
+            ch->req = req;
+            ch->bufOffset = 0;
+            return true;
+        }
+
+        CO_SDOclientClose(SDO_C);
+        CO_SDOqueue_finish(queue, req, ret, CO_SDO_AB_GENERAL, 0);
+
+        /* callback may have added or cancelled requests, so 'prev' and 'next' may be stale. Failed request is already
+         * unlinked, restart the walk from the beginning of the list. */
+        prev = NULL;
+        req = queue->first;
+    }
+    return false;
+}
+
+/*
+ * Process the transfer in progress on the channel. Returns true, if transfer is still in progress.
+ */
+static bool_t
+CO_SDOqueue_transfer(CO_SDOqueue_t* queue, CO_SDOqueueChannel_t* ch, uint32_t timeDifference_us,
+                     uint32_t* timerNext_us) {
+    CO_SDOrequest_t* req = ch->req;
+    CO_SDOclient_t* SDO_C = ch->SDO_C;
+    CO_SDO_return_t ret;
+    CO_SDO_abortCode_t abortCode = CO_SDO_AB_NONE;
+    size_t sizeTransferred = 0;
+
+    if (req->write) {
+        /* refill the SDO client buffer */
+        if (ch->bufOffset < req->bufSize) {
+            ch->bufOffset += CO_SDOclientDownloadBufWrite(SDO_C, &req->buf[ch->bufOffset],
+                                                          req->bufSize - ch->bufOffset);
+        }
+        ret = CO_SDOclientDownload(SDO_C, timeDifference_us, false, ch->bufOffset < req->bufSize, &abortCode,
+                                   &sizeTransferred, timerNext_us);
+    } else {
+        ret = CO_SDOclientUpload(SDO_C, timeDifference_us, false, &abortCode, NULL, &sizeTransferred, timerNext_us);
+
+        /* empty the SDO client buffer, if allowed */
+        if (ret != CO_SDO_RT_blockUploadInProgress) {
+            ch->bufOffset += CO_SDOclientUploadBufRead(SDO_C, &req->buf[ch->bufOffset], req->bufSize - ch->bufOffset);
+
+            if (CO_fifo_getOccupied(&SDO_C->bufFifo) > 0U) {
+                /* data does not fit into req->buf */
+                abortCode = CO_SDO_AB_OUT_OF_MEM;
+                if (ret > CO_SDO_RT_ok_communicationEnd) {
+                    ret = CO_SDOclientUpload(SDO_C, 0, true, &abortCode, NULL, NULL, NULL);
+                } else if (ret == CO_SDO_RT_ok_communicationEnd) {
+                    ret = CO_SDO_RT_endedWithClientAbort;
+                } else { /* MISRA C 2004 14.10 */
+                }
+            }
+        }
+        sizeTransferred = ch->bufOffset;
+    }
+
+    if (ret > CO_SDO_RT_ok_communicationEnd) {
+        return true;
+    }
+
+    ch->req = NULL;
+    CO_SDOclientClose(SDO_C);
+    CO_SDOqueue_finish(queue, req, ret, abortCode, sizeTransferred);
+    return false;
+}
+
+CO_ReturnError_t
+CO_SDOqueue_init(CO_SDOqueue_t* queue, CO_SDOqueueChannel_t channels[], CO_SDOclient_t SDOclients[],
+                 uint8_t channelsCount) {
+    /* verify arguments */
+    if ((queue == NULL) || (channels == NULL) || (SDOclients == NULL) || (channelsCount == 0U)) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
+
+    queue->channels = channels;
+    queue->channelsCount = channelsCount;
+    queue->first = NULL;
+    queue->last = NULL;
+    queue->completed = 0;
+    queue->failed = 0;
+
+    for (uint8_t i = 0; i < channelsCount; i++) {
+        channels[i].SDO_C = &SDOclients[i];
+        channels[i].req = NULL;
+        channels[i].bufOffset = 0;
+    }
+
+    return CO_ERROR_NO;
+}
+
+CO_ReturnError_t
+CO_SDOqueue_add(CO_SDOqueue_t* queue, CO_SDOrequest_t* req) {
+    /* verify arguments */
+    if ((queue == NULL) || (req == NULL) || (req->state != CO_SDO_REQ_IDLE) || (req->nodeId < 1U)
+        || (req->nodeId > 127U) || ((req->buf == NULL) && (req->bufSize > 0U))) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
+
+    req->next = NULL;
+    req->ret = CO_SDO_RT_waitingResponse;
+    req->abortCode = CO_SDO_AB_NONE;
+    req->sizeTransferred = 0;
+    req->state = CO_SDO_REQ_PENDING;
+
+    if (queue->last == NULL) {
+        queue->first = req;
+    } else {
+        queue->last->next = req;
+    }
+    queue->last = req;
+
+    return CO_ERROR_NO;
+}
+
+bool_t
+CO_SDOqueue_cancel(CO_SDOqueue_t* queue, CO_SDOrequest_t* req) {
+    CO_SDOrequest_t* prev = NULL;
+
+    if ((queue == NULL) || (req == NULL) || (req->state != CO_SDO_REQ_PENDING)) {
+        return false;
+    }
+
+    for (CO_SDOrequest_t* r = queue->first; r != NULL; r = r->next) {
+        if (r == req) {
+            if (prev == NULL) {
+                queue->first = req->next;
+            } else {
+                prev->next = req->next;
+            }
+            if (queue->last == req) {
+                queue->last = prev;
+            }
+            req->next = NULL;
+            req->state = CO_SDO_REQ_IDLE;
+            return true;
+        }
+        prev = r;
+    }
+    return false;
+}
+
+bool_t
+CO_SDOqueue_process(CO_SDOqueue_t* queue, uint32_t timeDifference_us, uint32_t* timerNext_us) {
+    bool_t inProgress = false;
+    bool_t startable = true; /* false, if the last search found no pending request, which can be started */
+
+    for (uint8_t i = 0; i < queue->channelsCount; i++) {
+        CO_SDOqueueChannel_t* ch = &queue->channels[i];
+        uint32_t timeDiff = timeDifference_us;
+
+        /* process transfer in progress, after the end start the next request immediately */
+        while ((ch->req != NULL) || startable) {
+            if (ch->req == NULL) {
+                startable = CO_SDOqueue_startNext(queue, ch);
+                if (!startable) {
+                    break;
+                }
+            }
+            if (CO_SDOqueue_transfer(queue, ch, timeDiff, timerNext_us)) {
+                inProgress = true;
+                break;
+            }
+            /* transfer finished, its node is free for pending requests */
+            startable = true;
+            timeDiff = 0;
+        }
+    }
+
+    return inProgress || (queue->first != NULL);
+}
+
+#endif /* (CO_CONFIG_SDO_QUEUE) & CO_CONFIG_SDO_QUEUE_ENABLE */
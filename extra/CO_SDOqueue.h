@@ -0,0 +1,207 @@
+/**
+ * CANopen SDO request queue, which multiplexes SDO transfers over SDO client channels.
+ *
+ * @file        CO_SDOqueue.h
+ * @ingroup     CO_SDOqueue
+ * @author      Janez Paternoster
+ * @copyright   2021 Janez Paternoster
+ *
+ * This file is part of <https://github.com/CANopenNode/CANopenNode>, a CANopen Stack.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ */
+
+#ifndef CO_SDO_QUEUE_H
+#define CO_SDO_QUEUE_H
+
+#include "301/CO_SDOclient.h"
+
+/* default configuration, see CO_config.h */
+#ifndef CO_CONFIG_SDO_QUEUE
+#define CO_CONFIG_SDO_QUEUE (0)
+#endif
+
+#if (((CO_CONFIG_SDO_QUEUE)&CO_CONFIG_SDO_QUEUE_ENABLE) != 0) || defined CO_DOXYGEN
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup CO_SDOqueue SDO request queue
+ * CANopen SDO request queue, which multiplexes SDO transfers over SDO client channels.
+ *
+ * @ingroup CO_CANopen_extra
+ * @{
+ * SDO client handles one transfer at a time and application must call CO_SDOclientUpload() or CO_SDOclientDownload()
+ * until the end of each transfer. SDO request queue is a layer above one or more SDO client channels. Application
+ * enqueues read and write requests, each with own node-ID, index, subindex, data buffer and callback, with
+ * CO_SDOqueue_add(). CO_SDOqueue_process() then starts pending requests on free SDO client channels, processes the
+ * transfers and calls the callback of each finished request.
+ *
+ * Only one transfer per SDO server node is in progress at a time, because SDO server has one channel. Transfers to
+ * different nodes run in parallel, as many as there are SDO client channels. Requests to the same node are processed
+ * in the order they were added. A request to a busy node does not block requests to other nodes behind it.
+ *
+ * Request objects are defined by application and are linked into the queue, so no memory is allocated. Request and its
+ * data buffer must exist until the callback is called or until request is removed with CO_SDOqueue_cancel().
+ *
+ * SDO client channels, used by the queue, must not be used by other parts of the application (for example gateway).
+ * CO_SDOqueue_add(), CO_SDOqueue_cancel() and CO_SDOqueue_process() must be called from the same thread. Callback is
+ * called from CO_SDOqueue_process() and may add new requests or cancel pending requests.
+ *
+ * Example:
+ * @code{.c}
+static CO_SDOqueueChannel_t channels[4];
+static CO_SDOqueue_t queue;
+static CO_SDOrequest_t req;
+static uint8_t value[4];
+
+void
+readDone(void* object, CO_SDOrequest_t* req) {
+    if (req->abortCode == CO_SDO_AB_NONE) {
+        // req->sizeTransferred bytes are in value
+    }
+}
+
+// in communication reset section, after CO_CANopenInit()
+CO_SDOqueue_init(&queue, channels, co->SDOclient, 4);
+
+// read 0x1018,1 from node 5
+req.nodeId = 5;
+req.index = 0x1018;
+req.subIndex = 1;
+req.write = false;
+req.buf = value;
+req.bufSize = sizeof(value);
+req.timeout_ms = 500;
+req.blockEnable = false;
+req.callback = readDone;
+req.object = NULL;
+CO_SDOqueue_add(&queue, &req);
+
+// in mainline
+CO_SDOqueue_process(&queue, timeDifference_us, &timerNext_us);
+ * @endcode
+ */
+
+/**
+ * State of the SDO request.
+ */
+typedef enum {
+    CO_SDO_REQ_IDLE = 0,    /**< Request is not in the queue, finished or cancelled */
+    CO_SDO_REQ_PENDING = 1, /**< Request is waiting in the queue */
+    CO_SDO_REQ_ACTIVE = 2   /**< Transfer of the request is in progress on SDO client channel */
+} CO_SDOrequest_state_t;
+
+/**
+ * SDO request, read or write of one variable in remote node.
+ *
+ * Members from nodeId to object are set by application before CO_SDOqueue_add(). Other members are set by the queue.
+ */
+typedef struct CO_SDOrequest_s {
+    uint8_t nodeId;      /**< Node-ID of the SDO server, 1 to 127 */
+    uint16_t index;      /**< Index of object in object dictionary in remote node */
+    uint8_t subIndex;    /**< Subindex of object in object dictionary in remote node */
+    bool_t write;        /**< True for SDO download (write), false for SDO upload (read) */
+    uint8_t* buf;        /**< Data to be written or buffer for data, which will be read */
+    size_t bufSize;      /**< Size of data to be written or size of buffer for data, which will be read */
+    uint16_t timeout_ms; /**< Timeout time for SDO communication in milliseconds */
+    bool_t blockEnable;  /**< Try to use block transfer */
+    void (*callback)(void* object, struct CO_SDOrequest_s* req); /**< Called, when request is finished, may be NULL */
+    void* object;                        /**< Pointer to object, which will be passed to callback */
+    volatile CO_SDOrequest_state_t state; /**< State of the request */
+    struct CO_SDOrequest_s* next;         /**< Next request in the queue */
+    CO_SDO_return_t ret;                  /**< Result of the finished transfer, see #CO_SDO_return_t */
+    CO_SDO_abortCode_t abortCode;         /**< SDO abort code of the finished transfer, CO_SDO_AB_NONE on success */
+    size_t sizeTransferred;               /**< Number of bytes written or read */
+} CO_SDOrequest_t;
+
+/**
+ * SDO client channel used by the queue.
+ */
+typedef struct {
+    CO_SDOclient_t* SDO_C; /**< SDO client object, from CO_SDOqueue_init() */
+    CO_SDOrequest_t* req;  /**< Request, which is in progress on this channel, or NULL */
+    size_t bufOffset;      /**< Number of bytes of req->buf, already copied into or from SDO client buffer */
+} CO_SDOqueueChannel_t;
+
+/**
+ * SDO request queue object.
+ */
+typedef struct {
+    CO_SDOqueueChannel_t* channels; /**< From CO_SDOqueue_init() */
+    uint8_t channelsCount;          /**< From CO_SDOqueue_init() */
+    CO_SDOrequest_t* first;         /**< First pending request or NULL */
+    CO_SDOrequest_t* last;          /**< Last pending request or NULL */
+    uint32_t completed;             /**< Number of requests finished successfully */
+    uint32_t failed;                /**< Number of requests finished with error */
+} CO_SDOqueue_t;
+
+/**
+ * Initialize SDO request queue.
+ *
+ * Function must be called in the communication reset section, after SDO clients are initialized.
+ *
+ * @param queue This object will be initialized.
+ * @param channels Array of channelsCount channel objects, defined by application.
+ * @param SDOclients Array of channelsCount initialized SDO client objects.
+ * @param channelsCount Number of SDO client channels used by the queue.
+ *
+ * @return #CO_ReturnError_t CO_ERROR_NO on success.
+ */
+CO_ReturnError_t CO_SDOqueue_init(CO_SDOqueue_t* queue, CO_SDOqueueChannel_t channels[], CO_SDOclient_t SDOclients[],
+                                  uint8_t channelsCount);
+
+/**
+ * Add request to the end of the queue.
+ *
+ * @param queue This object.
+ * @param req Request with members from nodeId to object set. It must not be already in the queue.
+ *
+ * @return #CO_ReturnError_t CO_ERROR_NO on success or CO_ERROR_ILLEGAL_ARGUMENT.
+ */
+CO_ReturnError_t CO_SDOqueue_add(CO_SDOqueue_t* queue, CO_SDOrequest_t* req);
+
+/**
+ * Remove pending request from the queue.
+ *
+ * Request, which transfer is already in progress, is not removed, its callback will be called.
+ *
+ * @param queue This object.
+ * @param req Request to remove.
+ *
+ * @return True, if request was pending and is removed. Callback is not called.
+ */
+bool_t CO_SDOqueue_cancel(CO_SDOqueue_t* queue, CO_SDOrequest_t* req);
+
+/**
+ * Process SDO request queue.
+ *
+ * Function must be called cyclically, it processes transfers in progress, calls callbacks of finished requests and
+ * starts pending requests on free channels.
+ *
+ * @param queue This object.
+ * @param timeDifference_us Time difference from previous function call in [microseconds].
+ * @param [out] timerNext_us info to OS - see CO_process().
+ *
+ * @return True, if transfers are in progress or requests are pending.
+ */
+bool_t CO_SDOqueue_process(CO_SDOqueue_t* queue, uint32_t timeDifference_us, uint32_t* timerNext_us);
+
+/** @} */ /* CO_SDOqueue */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* (CO_CONFIG_SDO_QUEUE) & CO_CONFIG_SDO_QUEUE_ENABLE */
+
+#endif /* CO_SDO_QUEUE_H */
@@ -0,0 +1,292 @@
+/*
+ * CANopen Concise DCF download, which configures remote node from concise DCF.
+ *
+ * @file        CO_conciseDCF.c
+ * @ingroup     CO_conciseDCF
+ * @author      Janez Paternoster
+ * @copyright   2021 Janez Paternoster
+ *
+ * This file is part of <https://github.com/CANopenNode/CANopenNode>, a CANopen Stack.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ */
+
+#include <string.h>
+
+#include "extra/CO_conciseDCF.h"
+
+#if ((CO_CONFIG_CONCISE_DCF)&CO_CONFIG_CONCISE_DCF_ENABLE) != 0
+
+/* verify configuration */
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_ENABLE) == 0
+#error CO_CONFIG_SDO_CLI_ENABLE must be enabled.
+#endif
+#if (CO_CONFIG_CONCISE_DCF_BLOCK_DL_LOOP < 1U) || (CO_CONFIG_CONCISE_DCF_BLOCK_DL_LOOP > 127U)
+#error CO_CONFIG_CONCISE_DCF_BLOCK_DL_LOOP must be from 1 to 127.
+#endif
+
+#define CO_CONCISE_DCF_INDEX       0x1F22U /* Concise DCF object in remote node */
+#define CO_CONCISE_DCF_COUNT_SIZE  4U      /* Size of number of entries at the start of the concise DCF */
+#define CO_CONCISE_DCF_HEADER_SIZE 7U      /* Size of index, subindex and data size of one entry */
+
+/*
+ * Read header of the entry at offset into index, subIndex, data and dataSize and advance offset to the next entry.
+ *
+ * Returns false, if entry does not fit into concise DCF.
+ */
+static bool_t
+CO_conciseDCF_nextEntry(CO_conciseDCF_t* cdcf) {
+    size_t remaining = cdcf->dcfSize - cdcf->offset;
+
+    if (remaining < CO_CONCISE_DCF_HEADER_SIZE) {
+        return false;
+    }
+
+    const uint8_t* entry = &cdcf->dcf[cdcf->offset];
+    uint32_t size = CO_SWAP_32(CO_getUint32(&entry[3]));
+    if (size > (remaining - CO_CONCISE_DCF_HEADER_SIZE)) {
+        return false;
+    }
+
+    cdcf->index = CO_SWAP_16(CO_getUint16(&entry[0]));
+    cdcf->subIndex = entry[2];
+    cdcf->data = &entry[CO_CONCISE_DCF_HEADER_SIZE];
+    cdcf->dataSize = size;
+    cdcf->offset += CO_CONCISE_DCF_HEADER_SIZE + (size_t)size;
+    return true;
+}
+
+/*
+ * Process SDO download of data, refill SDO client buffer before.
+ */
+static CO_SDO_return_t
+CO_conciseDCF_transfer(CO_conciseDCF_t* cdcf, uint32_t timeDifference_us, bool_t abort, CO_SDO_abortCode_t* abortCode,
+                       uint32_t* timerNext_us) {
+    CO_SDO_return_t ret;
+    uint32_t timeDiff = timeDifference_us;
+    uint32_t loop = 0;
+
+    /* if OS has CANtx queue, speedup block transfer */
+    do {
+        if (cdcf->dataOffset < cdcf->dataSize) {
+            cdcf->dataOffset += CO_SDOclientDownloadBufWrite(cdcf->SDO_C, &cdcf->data[cdcf->dataOffset],
+                                                             cdcf->dataSize - cdcf->dataOffset);
+        }
+        ret = CO_SDOclientDownload(cdcf->SDO_C, timeDiff, abort, cdcf->dataOffset < cdcf->dataSize, abortCode, NULL,
+                                   timerNext_us);
+        timeDiff = 0;
+        loop++;
+    } while ((ret == CO_SDO_RT_blockDownldInProgress) && (loop < CO_CONFIG_CONCISE_DCF_BLOCK_DL_LOOP));
+
+    return ret;
+}
+
+/*
+ * Report result of the entry in progress and count it.
+ *
+ * Returns false, if download must stop.
+ */
+static bool_t
+CO_conciseDCF_entryResult(CO_conciseDCF_t* cdcf, CO_SDO_return_t ret, CO_SDO_abortCode_t abortCode) {
+    CO_SDO_abortCode_t entryAbortCode = CO_SDO_AB_NONE;
+
+    if (ret != CO_SDO_RT_ok_communicationEnd) {
+        entryAbortCode = (abortCode != CO_SDO_AB_NONE) ? abortCode : CO_SDO_AB_GENERAL;
+        cdcf->entriesFailed++;
+        cdcf->ret = ret;
+        cdcf->abortCode = entryAbortCode;
+    }
+
+    if (cdcf->pFunctEntry != NULL) {
+        cdcf->pFunctEntry(cdcf->functEntryObject, cdcf->entryNo, cdcf->index, cdcf->subIndex, entryAbortCode);
+    }
+    cdcf->entryNo++;
+
+    return (ret == CO_SDO_RT_ok_communicationEnd) || !cdcf->stopOnError;
+}
+
+/*
+ * Initiate download of the next entry. Entries, which can not be initiated, are reported as failed.
+ *
+ * Returns false, if there are no more entries or download must stop.
+ */
+static bool_t
+CO_conciseDCF_startEntry(CO_conciseDCF_t* cdcf) {
+    while (cdcf->entryNo < cdcf->entriesCount) {
+        (void)CO_conciseDCF_nextEntry(cdcf); /* verified in CO_conciseDCF_start() */
+        cdcf->dataOffset = 0;
+
+        CO_SDO_return_t ret = CO_SDOclientDownloadInitiate(cdcf->SDO_C, cdcf->index, cdcf->subIndex, cdcf->dataSize,
+                                                           cdcf->timeout_ms, cdcf->blockEnable);
+        if (ret == CO_SDO_RT_ok_communicationEnd) {
+            return true;
+        }
+        if (!CO_conciseDCF_entryResult(cdcf, ret, CO_SDO_AB_GENERAL)) {
+            return false;
+        }
+    }
+    return false;
+}
+
+/*
+ * Start downloading entries one by one, from the first entry.
+ */
+static void
+CO_conciseDCF_startEntries(CO_conciseDCF_t* cdcf) {
+    cdcf->state = CO_CONCISE_DCF_ST_ENTRY;
+    cdcf->offset = CO_CONCISE_DCF_COUNT_SIZE;
+    cdcf->entryNo = 0;
+
+    if (!CO_conciseDCF_startEntry(cdcf)) {
+        cdcf->state = CO_CONCISE_DCF_ST_IDLE;
+        CO_SDOclientClose(cdcf->SDO_C);
+    }
+}
+
+CO_ReturnError_t
+CO_conciseDCF_init(CO_conciseDCF_t* cdcf, CO_SDOclient_t* SDO_C) {
+    /* verify arguments */
+    if ((cdcf == NULL) || (SDO_C == NULL)) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
+
+    (void)memset(cdcf, 0, sizeof(CO_conciseDCF_t));
+    cdcf->SDO_C = SDO_C;
+    cdcf->state = CO_CONCISE_DCF_ST_IDLE;
+    cdcf->ret = CO_SDO_RT_ok_communicationEnd;
+    cdcf->abortCode = CO_SDO_AB_NONE;
+
+    return CO_ERROR_NO;
+}
+
+void
+CO_conciseDCF_initCallbackEntry(CO_conciseDCF_t* cdcf, void* object,
+                                void (*pFunctEntry)(void* object, uint32_t entryNo, uint16_t index, uint8_t subIndex,
+                                                    CO_SDO_abortCode_t abortCode)) {
+    if (cdcf != NULL) {
+        cdcf->functEntryObject = object;
+        cdcf->pFunctEntry = pFunctEntry;
+    }
+}
+
+CO_ReturnError_t
+CO_conciseDCF_start(CO_conciseDCF_t* cdcf, uint8_t nodeId, const uint8_t* dcf, size_t dcfSize, uint16_t timeout_ms,
+                    uint8_t subIndex1F22, bool_t blockEnable, bool_t stopOnError) {
+    /* verify arguments */
+    if ((cdcf == NULL) || (dcf == NULL) || (dcfSize < CO_CONCISE_DCF_COUNT_SIZE) || (nodeId < 1U) || (nodeId > 127U)) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
+    if (cdcf->state != CO_CONCISE_DCF_ST_IDLE) {
+        return CO_ERROR_INVALID_STATE;
+    }
+
+    /* verify, that all entries fit exactly into concise DCF */
+    cdcf->dcf = dcf;
+    cdcf->dcfSize = dcfSize;
+    cdcf->entriesCount = CO_SWAP_32(CO_getUint32(dcf));
+    cdcf->offset = CO_CONCISE_DCF_COUNT_SIZE;
+    for (uint32_t i = 0; i < cdcf->entriesCount; i++) {
+        if (!CO_conciseDCF_nextEntry(cdcf)) {
+            return CO_ERROR_ILLEGAL_ARGUMENT;
+        }
+    }
+    if (cdcf->offset != dcfSize) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
+
+    if (CO_SDOclient_setup(cdcf->SDO_C, CO_CAN_ID_SDO_CLI + (uint32_t)nodeId, CO_CAN_ID_SDO_SRV + (uint32_t)nodeId,
+                           nodeId)
+        != CO_SDO_RT_ok_communicationEnd) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
+
+    cdcf->timeout_ms = timeout_ms;
+    cdcf->blockEnable = blockEnable;
+    cdcf->stopOnError = stopOnError;
+    cdcf->entryNo = 0;
+    cdcf->entriesFailed = 0;
+    cdcf->ret = CO_SDO_RT_ok_communicationEnd;
+    cdcf->abortCode = CO_SDO_AB_NONE;
+
+    /* try to download whole concise DCF with one transfer */
+    if (subIndex1F22 != 0U) {
+        cdcf->index = CO_CONCISE_DCF_INDEX;
+        cdcf->subIndex = subIndex1F22;
+        cdcf->data = dcf;
+        cdcf->dataSize = dcfSize;
+        cdcf->dataOffset = 0;
+        if (CO_SDOclientDownloadInitiate(cdcf->SDO_C, cdcf->index, cdcf->subIndex, dcfSize, timeout_ms, blockEnable)
+            == CO_SDO_RT_ok_communicationEnd) {
+            cdcf->state = CO_CONCISE_DCF_ST_OBJECT;
+            return CO_ERROR_NO;
+        }
+    }
+
+    CO_conciseDCF_startEntries(cdcf);
+    return CO_ERROR_NO;
+}
+
+CO_SDO_return_t
+CO_conciseDCF_process(CO_conciseDCF_t* cdcf, uint32_t timeDifference_us, uint32_t* timerNext_us) {
+    uint32_t timeDiff = timeDifference_us;
+
+    /* process transfer in progress, after the end start the next entry immediately */
+    while (cdcf->state != CO_CONCISE_DCF_ST_IDLE) {
+        CO_SDO_abortCode_t abortCode = CO_SDO_AB_NONE;
+        CO_SDO_return_t ret = CO_conciseDCF_transfer(cdcf, timeDiff, false, &abortCode, timerNext_us);
+
+        if (ret > CO_SDO_RT_ok_communicationEnd) {
+            return ret;
+        }
+        timeDiff = 0;
+
+        if (cdcf->state == CO_CONCISE_DCF_ST_OBJECT) {
+            if (ret == CO_SDO_RT_ok_communicationEnd) {
+                /* all entries are downloaded, report each of them */
+                cdcf->offset = CO_CONCISE_DCF_COUNT_SIZE;
+                while (cdcf->entryNo < cdcf->entriesCount) {
+                    (void)CO_conciseDCF_nextEntry(cdcf);
+                    (void)CO_conciseDCF_entryResult(cdcf, ret, CO_SDO_AB_NONE);
+                }
+                cdcf->state = CO_CONCISE_DCF_ST_IDLE;
+                CO_SDOclientClose(cdcf->SDO_C);
+            } else if (ret == CO_SDO_RT_endedWithServerAbort) {
+                /* remote node does not accept concise DCF, download entries one by one */
+                CO_conciseDCF_startEntries(cdcf);
+            } else {
+                cdcf->ret = ret;
+                cdcf->abortCode = (abortCode != CO_SDO_AB_NONE) ? abortCode : CO_SDO_AB_GENERAL;
+                cdcf->state = CO_CONCISE_DCF_ST_IDLE;
+                CO_SDOclientClose(cdcf->SDO_C);
+            }
+        } else if (!CO_conciseDCF_entryResult(cdcf, ret, abortCode) || !CO_conciseDCF_startEntry(cdcf)) {
+            cdcf->state = CO_CONCISE_DCF_ST_IDLE;
+            CO_SDOclientClose(cdcf->SDO_C);
+        } else { /* MISRA C 2004 14.10 */
+        }
+    }
+
+    return cdcf->ret;
+}
+
+void
+CO_conciseDCF_abort(CO_conciseDCF_t* cdcf) {
+    if ((cdcf != NULL) && (cdcf->state != CO_CONCISE_DCF_ST_IDLE)) {
+        CO_SDO_abortCode_t abortCode = CO_SDO_AB_GENERAL;
+
+        (void)CO_conciseDCF_transfer(cdcf, 0, true, &abortCode, NULL);
+        cdcf->ret = CO_SDO_RT_endedWithClientAbort;
+        cdcf->abortCode = abortCode;
+        cdcf->state = CO_CONCISE_DCF_ST_IDLE;
+        CO_SDOclientClose(cdcf->SDO_C);
+    }
+}
+
+#endif /* (CO_CONFIG_CONCISE_DCF) & CO_CONFIG_CONCISE_DCF_ENABLE */
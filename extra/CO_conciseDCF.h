@@ -0,0 +1,181 @@
+/**
+ * CANopen Concise DCF download, which configures remote node from concise DCF.
+ *
+ * @file        CO_conciseDCF.h
+ * @ingroup     CO_conciseDCF
+ * @author      Janez Paternoster
+ * @copyright   2021 Janez Paternoster
+ *
+ * This file is part of <https://github.com/CANopenNode/CANopenNode>, a CANopen Stack.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ */
+
+#ifndef CO_CONCISE_DCF_H
+#define CO_CONCISE_DCF_H
+
+#include "301/CO_SDOclient.h"
+
+/* default configuration, see CO_config.h */
+#ifndef CO_CONFIG_CONCISE_DCF
+#define CO_CONFIG_CONCISE_DCF (0)
+#endif
+#ifndef CO_CONFIG_CONCISE_DCF_BLOCK_DL_LOOP
+#define CO_CONFIG_CONCISE_DCF_BLOCK_DL_LOOP 127U
+#endif
+
+#if (((CO_CONFIG_CONCISE_DCF)&CO_CONFIG_CONCISE_DCF_ENABLE) != 0) || defined CO_DOXYGEN
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup CO_conciseDCF Concise DCF download
+ * CANopen Concise DCF download, which configures remote node from concise DCF.
+ *
+ * @ingroup CO_CANopen_extra
+ * @{
+ * Concise DCF is specified in CiA 302-3, it is a binary list of object dictionary entries with values. Format is
+ * (little endian):
+ * - UNSIGNED32: number of entries, followed by each entry:
+ *   - UNSIGNED16: index,
+ *   - UNSIGNED8: subindex,
+ *   - UNSIGNED32: data size in bytes,
+ *   - data.
+ *
+ * CO_conciseDCF_start() verifies the concise DCF and CO_conciseDCF_process() then downloads it to the remote node over
+ * one SDO client channel, without involvement of the application:
+ * - If subIndex1F22 is not zero, whole concise DCF is first downloaded with one SDO (block) transfer into object
+ *   0x1F22, subIndex1F22 of the remote node. If remote node does not support that (it responds with SDO abort),
+ *   entries are downloaded one by one.
+ * - Entries are downloaded one by one with expedited, segmented or block transfer, depending on the data size. When
+ *   one entry is finished, next is started immediately, within the same CO_conciseDCF_process() call.
+ *
+ * Result of each entry is reported with optional callback, see CO_conciseDCF_initCallbackEntry(). If whole concise
+ * DCF was downloaded into object 0x1F22, callback is called for each entry with CO_SDO_AB_NONE. Failed entry does not
+ * stop the download, unless stopOnError is set.
+ *
+ * SDO client channel must not be used by other parts of the application, while download is in progress.
+ */
+
+/**
+ * State of the Concise DCF download.
+ */
+typedef enum {
+    CO_CONCISE_DCF_ST_IDLE = 0,   /**< Download is not in progress */
+    CO_CONCISE_DCF_ST_OBJECT = 1, /**< Whole concise DCF is downloading into object 0x1F22 */
+    CO_CONCISE_DCF_ST_ENTRY = 2   /**< Entries are downloading one by one */
+} CO_conciseDCF_state_t;
+
+/**
+ * Concise DCF download object.
+ */
+typedef struct {
+    CO_SDOclient_t* SDO_C;         /**< From CO_conciseDCF_init() */
+    const uint8_t* dcf;            /**< From CO_conciseDCF_start() */
+    size_t dcfSize;                /**< From CO_conciseDCF_start() */
+    uint16_t timeout_ms;           /**< From CO_conciseDCF_start() */
+    bool_t blockEnable;            /**< From CO_conciseDCF_start() */
+    bool_t stopOnError;            /**< From CO_conciseDCF_start() */
+    CO_conciseDCF_state_t state;   /**< State of the download */
+    uint32_t entriesCount;         /**< Number of entries in concise DCF */
+    uint32_t entryNo;              /**< Number of entries already processed */
+    uint32_t entriesFailed;        /**< Number of entries, which failed */
+    size_t offset;                 /**< Offset of the next entry in dcf */
+    uint16_t index;                /**< Index of the entry in progress */
+    uint8_t subIndex;              /**< Subindex of the entry in progress */
+    const uint8_t* data;           /**< Data of the transfer in progress */
+    size_t dataSize;               /**< Size of the transfer in progress */
+    size_t dataOffset;             /**< Number of bytes of data, already copied into SDO client buffer */
+    CO_SDO_return_t ret;           /**< Result of the download, valid after the end */
+    CO_SDO_abortCode_t abortCode;  /**< SDO abort code of the last failed transfer or CO_SDO_AB_NONE */
+    void (*pFunctEntry)(void* object, uint32_t entryNo, uint16_t index, uint8_t subIndex,
+                        CO_SDO_abortCode_t abortCode); /**< From CO_conciseDCF_initCallbackEntry() or NULL */
+    void* functEntryObject;                            /**< From CO_conciseDCF_initCallbackEntry() or NULL */
+} CO_conciseDCF_t;
+
+/**
+ * Initialize Concise DCF download object.
+ *
+ * Function must be called in the communication reset section, after SDO client is initialized.
+ *
+ * @param cdcf This object will be initialized.
+ * @param SDO_C Initialized SDO client object, used for the download.
+ *
+ * @return #CO_ReturnError_t CO_ERROR_NO on success.
+ */
+CO_ReturnError_t CO_conciseDCF_init(CO_conciseDCF_t* cdcf, CO_SDOclient_t* SDO_C);
+
+/**
+ * Initialize callback function, which reports result of each entry.
+ *
+ * Callback is called from CO_conciseDCF_process().
+ *
+ * @param cdcf This object.
+ * @param object Pointer to object, which will be passed to pFunctEntry(). Can be NULL.
+ * @param pFunctEntry Pointer to the callback function. Arguments are number of the entry (starting with 0), its index,
+ * subindex and SDO abort code or CO_SDO_AB_NONE on success. Not called if NULL.
+ */
+void CO_conciseDCF_initCallbackEntry(CO_conciseDCF_t* cdcf, void* object,
+                                     void (*pFunctEntry)(void* object, uint32_t entryNo, uint16_t index,
+                                                         uint8_t subIndex, CO_SDO_abortCode_t abortCode));
+
+/**
+ * Start Concise DCF download.
+ *
+ * @param cdcf This object.
+ * @param nodeId Node-ID of the remote node, 1 to 127.
+ * @param dcf Concise DCF. It must exist until the end of the download.
+ * @param dcfSize Size of dcf in bytes.
+ * @param timeout_ms Timeout time for SDO communication in milliseconds.
+ * @param subIndex1F22 If not zero, try to download whole dcf into object 0x1F22 of the remote node, this subindex.
+ * @param blockEnable Try to use block transfer.
+ * @param stopOnError If true, stop the download after the first failed entry.
+ *
+ * @return #CO_ReturnError_t CO_ERROR_NO on success, CO_ERROR_INVALID_STATE if download is in progress or
+ * CO_ERROR_ILLEGAL_ARGUMENT if dcf is not valid.
+ */
+CO_ReturnError_t CO_conciseDCF_start(CO_conciseDCF_t* cdcf, uint8_t nodeId, const uint8_t* dcf, size_t dcfSize,
+                                     uint16_t timeout_ms, uint8_t subIndex1F22, bool_t blockEnable,
+                                     bool_t stopOnError);
+
+/**
+ * Process Concise DCF download.
+ *
+ * Function must be called cyclically, while download is in progress.
+ *
+ * @param cdcf This object.
+ * @param timeDifference_us Time difference from previous function call in [microseconds].
+ * @param [out] timerNext_us info to OS - see CO_process().
+ *
+ * @return #CO_SDO_return_t. Greater than 0, while download is in progress. CO_SDO_RT_ok_communicationEnd, if all
+ * entries were downloaded successfully. Less than 0, if any transfer failed, see abortCode and entriesFailed.
+ */
+CO_SDO_return_t CO_conciseDCF_process(CO_conciseDCF_t* cdcf, uint32_t timeDifference_us, uint32_t* timerNext_us);
+
+/**
+ * Abort Concise DCF download in progress.
+ *
+ * SDO abort message is sent to the remote node and the download ends with CO_SDO_RT_endedWithClientAbort.
+ *
+ * @param cdcf This object.
+ */
+void CO_conciseDCF_abort(CO_conciseDCF_t* cdcf);
+
+/** @} */ /* CO_conciseDCF */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* (CO_CONFIG_CONCISE_DCF) & CO_CONFIG_CONCISE_DCF_ENABLE */
+
+#endif /* CO_CONCISE_DCF_H */
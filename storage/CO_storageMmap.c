@@ -0,0 +1,315 @@
+/*
+ * CANopen data storage object for storing data into memory mapped file (Linux)
+ *
+ * @file        CO_storageMmap.c
+ * @author      Janez Paternoster
+ * @copyright   2021 Janez Paternoster
+ *
+ * This file is part of <https://github.com/CANopenNode/CANopenNode>, a CANopen Stack.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ */
+
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "storage/CO_storageMmap.h"
+#include "301/crc16-ccitt.h"
+
+#if ((CO_CONFIG_STORAGE)&CO_CONFIG_STORAGE_ENABLE) != 0
+
+#define CO_STORAGE_MMAP_MAGIC 0x6D6D4F43U /* 'C','O','m','m' from LSB to MSB */
+#define CO_STORAGE_MMAP_VALID 0xA55AU
+#define CO_STORAGE_MMAP_ALIGN(len) (((len) + 7U) & ~((size_t)7U))
+
+/* Header at the beginning of the file */
+typedef struct {
+    uint32_t magic;
+    uint32_t versionTag;
+    uint32_t entriesCount;
+    uint32_t fileLength;
+} CO_storageMmap_fileHeader_t;
+
+/* Header in front of data of each entry */
+typedef struct {
+    uint32_t len;
+    uint16_t crc;
+    uint16_t valid;
+} CO_storageMmap_slotHeader_t;
+
+/*
+ * Write data range of the mapped file to the disk. Address passed to msync() must be page aligned.
+ */
+static bool_t
+syncRange(CO_storageMmap_t* mod, size_t fileOffset, size_t len, int flags) {
+    size_t pageStart = fileOffset - (fileOffset % mod->pageSize);
+    return msync(mod->map + pageStart, (fileOffset + len) - pageStart, flags) == 0;
+}
+
+/*
+ * Copy data into the mapped file, only pages which differ. Changed pages are synced with msync(flags), if flags != 0.
+ */
+static bool_t
+copyDirtyPages(CO_storageMmap_t* mod, size_t fileOffset, const uint8_t* src, size_t len, int flags) {
+    bool_t ok = true;
+    size_t pos = 0;
+
+    while (pos < len) {
+        size_t chunkStart = fileOffset + pos;
+        size_t chunkLen = mod->pageSize - (chunkStart % mod->pageSize);
+        if (chunkLen > (len - pos)) {
+            chunkLen = len - pos;
+        }
+
+        if (memcmp(mod->map + chunkStart, src + pos, chunkLen) != 0) {
+            (void)memcpy(mod->map + chunkStart, src + pos, chunkLen);
+            if ((flags != 0) && !syncRange(mod, chunkStart, chunkLen, flags)) {
+                ok = false;
+            }
+        }
+        pos += chunkLen;
+    }
+
+    return ok;
+}
+
+/*
+ * Write slot header of the entry with the specified CRC and valid marker and sync it to the disk.
+ */
+static bool_t
+writeSlot(CO_storageMmap_t* mod, CO_storage_entry_t* entry, uint16_t crc) {
+    CO_storageMmap_slotHeader_t slot;
+
+    slot.len = (uint32_t)entry->len;
+    slot.crc = crc;
+    slot.valid = CO_STORAGE_MMAP_VALID;
+    (void)memcpy(mod->map + entry->offset, &slot, sizeof(slot));
+
+    return syncRange(mod, entry->offset, sizeof(slot), MS_SYNC);
+}
+
+/*
+ * Function for writing data on "Store parameters" command - OD object 1010
+ *
+ * For more information see file CO_storage.h, CO_storage_entry_t.
+ */
+static ODR_t
+storeMmap(CO_storage_entry_t* entry, CO_CANmodule_t* CANmodule) {
+    (void)CANmodule;
+    CO_storageMmap_t* mod = (CO_storageMmap_t*)entry->storageModule;
+    size_t dataOffset = entry->offset + sizeof(CO_storageMmap_slotHeader_t);
+
+    /* copy changed pages of data and write them to disk */
+    if (!copyDirtyPages(mod, dataOffset, (const uint8_t*)entry->addr, entry->len, MS_SYNC)) {
+        return ODR_HW;
+    }
+
+    /* Verify data in file and write slot header */
+    entry->crc = crc16_ccitt(entry->addr, entry->len, 0);
+    if (crc16_ccitt(mod->map + dataOffset, entry->len, 0) != entry->crc) {
+        return ODR_HW;
+    }
+
+    return writeSlot(mod, entry, entry->crc) ? ODR_OK : ODR_HW;
+}
+
+/*
+ * Function for restoring data on "Restore default parameters" command - OD 1011
+ *
+ * For more information see file CO_storage.h, CO_storage_entry_t.
+ */
+static ODR_t
+restoreMmap(CO_storage_entry_t* entry, CO_CANmodule_t* CANmodule) {
+    (void)CANmodule;
+    CO_storageMmap_t* mod = (CO_storageMmap_t*)entry->storageModule;
+
+    /* Clear slot header, data stays in the file, but is not used on next startup */
+    (void)memset(mod->map + entry->offset, 0, sizeof(CO_storageMmap_slotHeader_t));
+
+    return syncRange(mod, entry->offset, sizeof(CO_storageMmap_slotHeader_t), MS_SYNC) ? ODR_OK : ODR_HW;
+}
+
+CO_ReturnError_t
+CO_storageMmap_init(CO_storage_t* storage, CO_CANmodule_t* CANmodule, CO_storageMmap_t* storageModule,
+                    const char* fileName, uint32_t versionTag, OD_entry_t* OD_1010_StoreParameters,
+                    OD_entry_t* OD_1011_RestoreDefaultParam, CO_storage_entry_t* entries, uint8_t entriesCount,
+                    uint32_t* storageInitError) {
+    CO_ReturnError_t ret;
+    CO_storageMmap_fileHeader_t header;
+    struct stat st;
+
+    /* verify arguments */
+    if ((storage == NULL) || (storageModule == NULL) || (fileName == NULL) || (entries == NULL)
+        || (entriesCount == 0U) || (entriesCount > CO_CONFIG_STORAGE_MAX_ENTRIES_COUNT)
+        || (storageInitError == NULL)) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
+
+    storage->enabled = false;
+    storageModule->fd = -1;
+    storageModule->map = NULL;
+
+    /* initialize storage and OD extensions */
+    ret = CO_storage_init(storage, CANmodule, OD_1010_StoreParameters, OD_1011_RestoreDefaultParam, storeMmap,
+                          restoreMmap, entries, entriesCount);
+    if (ret != CO_ERROR_NO) {
+        return ret;
+    }
+
+    /* verify entries and calculate their offsets inside the file */
+    size_t fileLength = sizeof(header);
+    for (uint8_t i = 0; i < entriesCount; i++) {
+        CO_storage_entry_t* entry = &entries[i];
+
+        if ((entry->addr == NULL) || (entry->len == 0U) || (entry->subIndexOD < 2U)) {
+            *storageInitError = i;
+            return CO_ERROR_ILLEGAL_ARGUMENT;
+        }
+        entry->storageModule = storageModule;
+        entry->offset = fileLength;
+        fileLength += sizeof(CO_storageMmap_slotHeader_t) + CO_STORAGE_MMAP_ALIGN(entry->len);
+    }
+    if (fileLength > 0xFFFFFFFFU) {
+        *storageInitError = entriesCount - 1U;
+        return CO_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* open and map the file */
+    long pageSize = sysconf(_SC_PAGESIZE);
+    storageModule->pageSize = (pageSize > 0) ? (size_t)pageSize : 4096U;
+    storageModule->fd = open(fileName, O_RDWR | O_CREAT, 0644);
+    if ((storageModule->fd < 0) || (fstat(storageModule->fd, &st) != 0)) {
+        CO_storageMmap_close(storageModule);
+        *storageInitError = 0xFFFFFFFFU;
+        return CO_ERROR_SYSCALL;
+    }
+    bool_t fileNew = (size_t)st.st_size != fileLength;
+    if (fileNew && (ftruncate(storageModule->fd, (off_t)fileLength) != 0)) {
+        CO_storageMmap_close(storageModule);
+        *storageInitError = 0xFFFFFFFFU;
+        return CO_ERROR_SYSCALL;
+    }
+    void* map = mmap(NULL, fileLength, PROT_READ | PROT_WRITE, MAP_SHARED, storageModule->fd, 0);
+    if (map == MAP_FAILED) {
+        CO_storageMmap_close(storageModule);
+        *storageInitError = 0xFFFFFFFFU;
+        return CO_ERROR_SYSCALL;
+    }
+    storageModule->map = (uint8_t*)map;
+    storageModule->mapLen = fileLength;
+
+    /* verify file header, re-create file if it does not match */
+    (void)memcpy(&header, storageModule->map, sizeof(header));
+    if (fileNew || (header.magic != CO_STORAGE_MMAP_MAGIC) || (header.versionTag != versionTag)
+        || (header.entriesCount != entriesCount) || (header.fileLength != (uint32_t)fileLength)) {
+        (void)memset(storageModule->map, 0, fileLength);
+        header.magic = CO_STORAGE_MMAP_MAGIC;
+        header.versionTag = versionTag;
+        header.entriesCount = entriesCount;
+        header.fileLength = (uint32_t)fileLength;
+        (void)memcpy(storageModule->map, &header, sizeof(header));
+        if (!syncRange(storageModule, 0, fileLength, MS_SYNC)) {
+            CO_storageMmap_close(storageModule);
+            *storageInitError = 0xFFFFFFFFU;
+            return CO_ERROR_SYSCALL;
+        }
+    }
+
+    /* initialize entries */
+    *storageInitError = 0;
+    for (uint8_t i = 0; i < entriesCount; i++) {
+        CO_storage_entry_t* entry = &entries[i];
+        bool_t isAuto = (entry->attr & (uint8_t)CO_storage_auto) != 0U;
+        CO_storageMmap_slotHeader_t slot;
+        const uint8_t* data = storageModule->map + entry->offset + sizeof(slot);
+
+        (void)memcpy(&slot, storageModule->map + entry->offset, sizeof(slot));
+        entry->crc = slot.crc;
+
+        /* Verify slot header and CRC, except for auto storage variables */
+        bool_t dataCorrupt = false;
+        if ((slot.valid != CO_STORAGE_MMAP_VALID) || (slot.len != (uint32_t)entry->len)) {
+            dataCorrupt = true;
+        } else if (!isAuto && (crc16_ccitt(data, entry->len, 0) != slot.crc)) {
+            dataCorrupt = true;
+        } else {
+            (void)memcpy(entry->addr, data, entry->len);
+        }
+
+        /* Auto storage entry without valid slot (new file or after restore command) is initialized with actual data,
+         * so CO_storageMmap_auto_process() updates a valid slot and data is used on next startup. */
+        if (dataCorrupt && isAuto) {
+            (void)memcpy(storageModule->map + entry->offset + sizeof(slot), entry->addr, entry->len);
+            entry->crc = crc16_ccitt(entry->addr, entry->len, 0);
+            if (!syncRange(storageModule, entry->offset + sizeof(slot), entry->len, MS_SYNC)
+                || !writeSlot(storageModule, entry, entry->crc)) {
+                CO_storageMmap_close(storageModule);
+                *storageInitError = 0xFFFFFFFFU;
+                return CO_ERROR_SYSCALL;
+            }
+        }
+
+        /* additional info in case of error */
+        if (dataCorrupt) {
+            uint32_t errorBit = entry->subIndexOD;
+            if (errorBit > 31U) {
+                errorBit = 31;
+            }
+            *storageInitError |= ((uint32_t)1) << errorBit;
+            ret = CO_ERROR_DATA_CORRUPT;
+        }
+    } /* for (entries) */
+
+    storage->enabled = true;
+    return ret;
+}
+
+void
+CO_storageMmap_auto_process(CO_storage_t* storage, bool_t saveAll) {
+    /* verify arguments */
+    if ((storage == NULL) || !storage->enabled) {
+        return;
+    }
+
+    /* loop through entries */
+    for (uint8_t n = 0; n < storage->entriesCount; n++) {
+        CO_storage_entry_t* entry = &storage->entries[n];
+        CO_storageMmap_t* mod = (CO_storageMmap_t*)entry->storageModule;
+
+        if ((entry->attr & (uint8_t)CO_storage_auto) == 0U) {
+            continue;
+        }
+
+        /* Auto entry is valid only, if its slot header was written by store command */
+        size_t dataOffset = entry->offset + sizeof(CO_storageMmap_slotHeader_t);
+        (void)copyDirtyPages(mod, dataOffset, (const uint8_t*)entry->addr, entry->len, saveAll ? MS_SYNC : 0);
+    }
+}
+
+void
+CO_storageMmap_close(CO_storageMmap_t* storageModule) {
+    if (storageModule == NULL) {
+        return;
+    }
+    if (storageModule->map != NULL) {
+        (void)msync(storageModule->map, storageModule->mapLen, MS_SYNC);
+        (void)munmap(storageModule->map, storageModule->mapLen);
+        storageModule->map = NULL;
+    }
+    if (storageModule->fd >= 0) {
+        (void)close(storageModule->fd);
+        storageModule->fd = -1;
+    }
+}
+
+#endif /* (CO_CONFIG_STORAGE) & CO_CONFIG_STORAGE_ENABLE */
@@ -0,0 +1,132 @@
+/**
+ * CANopen data storage object for storing data into memory mapped file (Linux)
+ *
+ * @file        CO_storageMmap.h
+ * @ingroup     CO_storage_mmap
+ * @author      Janez Paternoster
+ * @copyright   2021 Janez Paternoster
+ *
+ * This file is part of <https://github.com/CANopenNode/CANopenNode>, a CANopen Stack.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ */
+
+#ifndef CO_STORAGE_MMAP_H
+#define CO_STORAGE_MMAP_H
+
+#include "storage/CO_storage.h"
+
+#ifndef CO_CONFIG_STORAGE_MAX_ENTRIES_COUNT
+#define CO_CONFIG_STORAGE_MAX_ENTRIES_COUNT 5U
+#endif
+
+#if (((CO_CONFIG_STORAGE)&CO_CONFIG_STORAGE_ENABLE) != 0) || defined CO_DOXYGEN
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup CO_storage_mmap Data storage in memory mapped file
+ * Memory mapped file specific data storage functions for POSIX (Linux) hosts.
+ *
+ * @ingroup CO_CANopen_storage
+ * @{
+ * This is an interface into generic CANopenNode @ref CO_storage, which keeps image of all storage entries in a single
+ * file, mapped into memory with mmap(). Entry members storageModule, crc and offset are used, as documented for
+ * @ref CO_storage_entry_t.
+ *
+ * File layout:
+ * - File header: magic "COmm", version tag, entries count and file length.
+ * - For each entry: 8-byte slot header (data length, CRC of data and valid marker) followed by data, aligned to 8
+ *   bytes.
+ *
+ * Version tag is specified by application, for example from the Object Dictionary version. If file does not exist,
+ * or file header does not match (different magic, version tag, entries count or length), then file is re-created and
+ * all entries are indicated as corrupt, so default values from the Object Dictionary stay.
+ *
+ * On startup data is copied from mapped pages, without separate read() into a buffer. Data must be in the OD variables
+ * before @ref CO_CANopenInit(), so startup still pages in the whole file and verifies CRC of each entry, except for
+ * auto storage entries. Store command (0x1010) compares data with mapped image page by page, copies only pages which
+ * differ and msync()s them. Then slot header with new CRC is written and synced. Restore command (0x1011) clears valid
+ * marker in slot header.
+ *
+ * If entry attribute has CO_storage_auto set, then data block is copied into mapped image by
+ * @ref CO_storageMmap_auto_process(). Dirty pages are written to the file asynchronously by the operating system. If
+ * slot of auto storage entry is not valid on startup (new file or after restore command), it is initialized with the
+ * actual (default) data, so later changes are used on next startup without store command.
+ */
+
+/**
+ * Memory mapped storage module, one per storage file.
+ */
+typedef struct {
+    int fd;          /**< File descriptor of the opened file */
+    uint8_t* map;    /**< Base address of the mapped file, NULL if not mapped */
+    size_t mapLen;   /**< Length of the mapped file */
+    size_t pageSize; /**< Page size of the system, used for msync() */
+} CO_storageMmap_t;
+
+/**
+ * Initialize data storage object (memory mapped file specific)
+ *
+ * This function should be called by application after the program startup, before @ref CO_CANopenInit(). This function
+ * initializes storage object, OD extensions on objects 1010 and 1011, maps the file, verifies data and copies data to
+ * addresses specified inside entries. This function internally calls @ref CO_storage_init().
+ *
+ * @param storage This object will be initialized. It must be defined by application and must exist permanently.
+ * @param CANmodule CAN device, for optional usage.
+ * @param storageModule Memory mapped storage module, will be initialized. It must exist permanently.
+ * @param fileName Name of the file, which holds image of all entries. It is created, if it does not exist.
+ * @param versionTag Version tag of the stored data. If it differs from tag in the file, file is re-created.
+ * @param OD_1010_StoreParameters OD entry for 0x1010 -"Store parameters". Entry is optional, may be NULL.
+ * @param OD_1011_RestoreDefaultParam OD entry for 0x1011 -"Restore default parameters". Entry is optional, may be NULL.
+ * @param entries Pointer to array of storage entries, see @ref CO_storage_init.
+ * @param entriesCount Count of storage entries, must not be larger than CO_CONFIG_STORAGE_MAX_ENTRIES_COUNT.
+ * @param [out] storageInitError If function returns CO_ERROR_DATA_CORRUPT, then this variable contains a bit mask from
+ * subIndexOD values, where data was not properly initialized. If other error, then this variable contains index or
+ * erroneous entry. If file can not be opened or mapped, then storageInitError is 0xFFFFFFFF and function returns
+ * CO_ERROR_SYSCALL.
+ *
+ * @return CO_ERROR_NO, CO_ERROR_DATA_CORRUPT if data can not be initialized, CO_ERROR_ILLEGAL_ARGUMENT,
+ * CO_ERROR_OUT_OF_MEMORY or CO_ERROR_SYSCALL.
+ */
+CO_ReturnError_t CO_storageMmap_init(CO_storage_t* storage, CO_CANmodule_t* CANmodule, CO_storageMmap_t* storageModule,
+                                     const char* fileName, uint32_t versionTag, OD_entry_t* OD_1010_StoreParameters,
+                                     OD_entry_t* OD_1011_RestoreDefaultParam, CO_storage_entry_t* entries,
+                                     uint8_t entriesCount, uint32_t* storageInitError);
+
+/**
+ * Automatically update data if differs inside memory mapped file.
+ *
+ * Should be called cyclically by program. Changed pages of entries with CO_storage_auto attribute are copied into
+ * mapped file.
+ *
+ * @param storage This object
+ * @param saveAll If true, changed pages are also synchronously written to the file, useful on program end.
+ */
+void CO_storageMmap_auto_process(CO_storage_t* storage, bool_t saveAll);
+
+/**
+ * Unmap and close the file.
+ *
+ * @param storageModule Memory mapped storage module.
+ */
+void CO_storageMmap_close(CO_storageMmap_t* storageModule);
+
+/** @} */ /* CO_storage_mmap */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* (CO_CONFIG_STORAGE) & CO_CONFIG_STORAGE_ENABLE */
+
+#endif /* CO_STORAGE_MMAP_H */